@@ -12,7 +12,10 @@
 **  (it was a REALLY BIG DEAL back in 1995, for those of us who remember)
 **  The NEWEST version is targeted at AMD64 with multiple cores on Linux or BSD.  That's right, it
 **  adds THREADING to the algorithm.  When I did a comparison, the 'breakover' point was around 2000,
-**  where the threaded version stops taking longer and starts improving the time.
+**  where the threaded version stops taking longer and starts improving the time.  That was with
+**  a new thread for every digit.  The worker threads (one per arctan series after the first) are
+**  now created ONCE and handed each sweep through a spin-then-block 'gate', so the breakover is a
+**  lot lower (see 'USE_THREAD'), and 'pi --tune' measures it on the machine it runs on.
 **  You can define 'SINGLE_THREAD' to build a 'single thread' version, or you can modify the value of
 **  'USE_THREAD' to change the point at which threads are used.
 **
@@ -21,6 +24,9 @@
 **  CRASHED when I attempted to run it on FreeBSD (revealing the bug).  Preliminary testing revealed
 **  I need at least '[32]', but the actual size requirement for this array is currently "not determined".
 **
+**  ANOTHER BUG FIX:  the terms and divisors were 32-bit, and (term * 10 + carry) for the 'ms' series
+**  overflowed once a run went past about 8,900 digits.  They are 64-bit now (see 'shift').
+**
 **  A few notes about this program
 **  I found it without any copyright on the internet back in 1995, and did some mods to it so
 **  that it would a) compile in windows and b) run faster (including the inline assembly).
@@ -33,8 +39,67 @@
 **
 */
 
-// Linux/BSD/Cygwin BUILD: gcc -O2 -o pi pi.c -Wall -lpthread
-// Linux/BSD/Cygwin SINGLE THREAD BUILD: gcc -O2 -o pi pi.c -Wall -DSINGLE_THREAD
+// Linux/BSD/Cygwin BUILD: gcc -O2 -o pi pi.c -Wall -lpthread -lm
+// Linux/BSD/Cygwin SINGLE THREAD BUILD: gcc -O2 -o pi pi.c -Wall -DSINGLE_THREAD -lm
+// LIBRARY BUILD (no 'main', see pi.h): gcc -O2 -c -DPI_LIBRARY pi.c -Wall
+//
+// USAGE:  pi [-k digits_per_sweep] [-r] [-f formula] [-c] [-o file] [-m memory] [-s seconds] <number_of_digits>
+//         '-k' multiplies by 10^k (k = 1 to 9) on every pass through the arrays, so each
+//         pass yields k digits instead of 1.  That's roughly k times fewer passes.
+//         '-r' precomputes a reciprocal table for each series so the sweeps multiply instead
+//         of divide.  The tables cost as much as the terms, which is reported on stderr.
+//         '-f' picks the Machin-like formula:  'machin' (the default), 'stormer', 'takano',
+//         or a list of c:x pairs for c * atan(1/x), like '16:5,-4:239'.  Each term of the
+//         formula gets a thread of its own, so a 4-term formula can use 4 cores.
+//         '-c' uses the Chudnovsky engine instead of the spigot (see 'chud_run').  It's
+//         O(n log^2 n) instead of O(n^2), a million digits takes seconds, not hours.
+//         The other options only apply to the spigot.
+//         '-t' uses the wavefront engine with that many threads (1 = cache blocking only),
+//         '-b' is its block size in terms (default 8192), and '-d' the number of sweeps
+//         it runs over each block while it's in cache (default 16).  See 'tile_run'.
+//         '-o' writes the digits to a file packed 2 to a byte instead of printing them.
+//         '-m' is where the terms live:  'heap', 'thp' or 'huge' (huge pages), or a directory
+//         to map them from files in, for runs bigger than RAM.  See 'term_alloc'.
+//         '-s' saves a checkpoint every so many seconds, to 'pi.ckp' or the '-S' file.
+//         '-i' reports progress on stderr every so many seconds:  digits done, digits/s,
+//         the sweep length, how busy each thread was and the time left.  '-I' keeps the
+//         same numbers in a shared memory segment by that name (see 'PI_STATS' in pi.h).
+//
+//         pi [-c] [other options] --store file <number_of_digits>
+//         pi --query file first_digit [count]
+//         keeps the digits in 'file' so they don't have to be computed again, and prints
+//         any range of them from it.  A store asked for more digits than it has gets the
+//         new ones added on the end.  See 'store_extend'.
+//
+//         pi --search file digits [count]
+//         pi --index file [k]
+//         finds a string of digits in a store (or a '-o' file) and prints the first
+//         'count' places it starts (10 by default).  It scans the whole file unless
+//         '--index' has made 'file.idx' for it.  See 'search_index'.
+//
+//         pi --monitor name [seconds]
+//         follows the '-I name' segment of a run from another terminal.  (older glibc
+//         needs '-lrt' on the build line for these)
+//
+//         pi --resume [file] >> output
+//         carries on from a checkpoint, appending to the output of the run that was
+//         killed.  See 'ckpt_save'.
+//
+//         pi [-f formula] [-k digits_per_sweep] [-r] --tune [profile]
+//         measures where the threaded sweeps start to pay off on this machine and saves
+//         it in 'pi.prof' (or 'profile'), which later runs read ('-P' names another one).
+//
+//         pi --bench [csv|json] [max_digits]
+//         times a set of configurations from 1,000 digits up to 'max_digits' (a million)
+//         and prints the phase times for each run.  See 'bench_run'.
+//
+//         pi -x position[,position...]
+//         prints 8 hex digits of pi starting at each position (1 is the first one after the
+//         point) with the BBP formula, no digits before them needed.
+//
+//         pi --verify file [positions]
+//         spot-checks the digits in a file this program wrote by converting them to hex at
+//         a few positions (8 by default) and comparing with BBP.  See 'verify_run'.
 //
 // (this will probably work on OSX as well)
 
@@ -49,10 +114,24 @@
 #include <malloc.h>
 #else  // _WIN32
 #include <unistd.h>
+#include <stdint.h>
 #include <sys/time.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <signal.h>
 #include <pthread.h>
 #endif  // _WIN32
 #include <string.h>
+#include <math.h>
+#include <setjmp.h> /* the library's way out of a failed run, see 'run_fail' */
+#if defined(__SSE2__)
+#include <emmintrin.h> /* the digit search, see 'search_scan' */
+#endif // __SSE2__
+
+#include "pi.h"
 
 // WIN32 fixes[this used to be a WIN16 app with some non-standard symbols]
 #define FAR
@@ -68,6 +147,19 @@
 #define int32_t long
 #endif // int32_t
 
+#ifndef int64_t
+#define int64_t __int64
+#define uint64_t unsigned __int64
+#define uint32_t unsigned long
+#endif // int64_t
+
+#ifndef INT64_MAX
+#define INT64_MAX 0x7fffffffffffffffi64
+#endif // INT64_MAX
+#ifndef INT32_MAX
+#define INT32_MAX 0x7fffffff
+#endif // INT32_MAX
+
 #else // gcc compile
 
 // 32-bit vs 64-bit pointers
@@ -93,29 +185,154 @@
 // NEW output fails to match old 'million digit' run (using 7/95 WIN32 code) after about 89,000 digits
 
 #ifndef SINGLE_THREAD
-#define USE_THREAD 2000 /* based on performance comparison measurements */
+#define USE_THREAD 500 /* the worker is persistent now, so only the sweep handoff has to pay off */
 #endif // SINGLE_THREAD
 
+#define MAX_CHUNK 9 /* most digits per sweep, i.e. 10^9, the largest power of 10 that fits in 'stor[]' */
+
+#define MAX_SERIES 8      /* most arctan terms in a formula ('-f') */
+#define MAX_SERIES_X 1000000L /* largest x in atan(1/x), so (2i - 1) * x * x fits easily in 64 bits */
+
 // uncomment this to determine the requirements (and boundary check) the 'stor[]' array
 // #define CHECK_LOC
 
 
-// GLOBAL VARIABLES - original author seemed to want to use these
-// it's probably much faster to use a structure.  nearly every MODERN CPU
-// nowadays can directly access members via an offset to a structure pointer
-// within one or 2 clock cycles
-// TODO:  move these into a structure, pass structure pointer to functions
+// ENGINE STATE - these were all globals once, which meant one run per process.  Now
+// everything a run changes is in its PI_ENGINE (pi.h), and the sweeps, the output and the
+// threads that work on them are handed a pointer to it ('pE'), so several engines can run
+// in one process at once, each with its own threads.  (it's no slower, the members are
+// just an offset from a pointer that stays in a register)  What's still global is set once
+// for the whole process ('-m', the '--tune' profile) or belongs to the program rather than
+// a run:  checkpoints, telemetry and '--bench' have only ever had the one engine to watch.
 
-int32_t FAR * mf, FAR * ms;
-int32_t kf, ks;
-int32_t cnt, n, temp, nd;
-int32_t i;
-int32_t col, col1;
-int32_t loc, stor[STOR_SIZE];
+// one c * atan(1/x) term of the formula (see 'set_formula').  For Machin's formula there are
+// two of these, what used to be 'mf' (16 * atan(1/5)) and 'ms' (-4 * atan(1/239))
+
+typedef struct _ARCTAN_SERIES_
+{
+  int64_t FAR * pa;  // the terms, 1 through 'nLen'
+  uint64_t FAR * pr; // reciprocal table ('-r'), otherwise NULL
+  int64_t c;         // the coefficient
+  int64_t x;         // and the argument, 1/x
+  int64_t kk;        // x * x, what each term divides by
+  int32_t nLen;      // terms allocated (see 'series_len')
+  double dLog;       // log10(kk), the digits each term is worth
+  Size_T acbKept[2]; // bytes of 'pa' and 'pr' not given back yet (see 'term_trim')
+} ARCTAN_SERIES;
+
+#define OUT_BLOCK 65536 /* bytes in each output block, see 'OUTPUT' */
+#define OUT_RING 8      /* blocks in the ring */
+
+#ifdef USE_THREAD
+// the threads' own state, which the engine holds (see 'SWEEP GATE', 'PER-SERIES WORKERS'
+// and 'WAVEFRONT ENGINE' for what they do)
+
+typedef struct _SWEEP_GATE_
+{
+  volatile unsigned int nSeq; // incremented every time the gate is posted
+  volatile int nWaiters;      // number of threads blocked on 'cond'
+  pthread_mutex_t mtx;
+  pthread_cond_t cond;
+} SWEEP_GATE;
+
+typedef struct _SERIES_WORKER_
+{
+  SWEEP_GATE gateStart, gateDone; // main thread -> worker, worker -> main thread
+  volatile int32_t nLen;  // the sweep length for the worker, 0 to exit
+  int32_t nUpHi, nUpLo;   // the part of the NEXT series 0 sweep it does, if any ('threaded_sweep')
+  int64_t llVal;          // term 1 after the worker's sweep (see 'sweep_series')
+  uint64_t ullCarry;      // the carry out of the worker's part of series 0
+  unsigned int nDoneSeen; // the last 'gateDone' the main thread saw
+  pthread_t idThread;
+  int nIndex;             // the series it sweeps
+  PI_ENGINE *pE;          // and whose
+} SERIES_WORKER;
+
+typedef struct _TILE_WORKER_
+{
+  volatile int64_t llDone; // batch * nTileBlocks + blocks finished, for the last batch it started
+  SWEEP_GATE gate;         // posted every time 'llDone' changes
+  pthread_t idThread;
+  int nIndex;
+  PI_ENGINE *pE;
+  char cPad[64];           // keeps the next one's 'llDone' off this one's cache line
+} TILE_WORKER;
+#endif // USE_THREAD
+
+struct _PI_ENGINE_
+{
+  int32_t nDigits;                 // what 'pi_engine_create' was given
+  PI_OPTIONS opts;
+  char szFormula[MAX_SERIES * 48]; // 'opts.pFormula' points here
+
+  // the formula ('set_formula')
+  ARCTAN_SERIES aSeries[MAX_SERIES]; // sorted by 'x', so [0] is the longest
+  int nSeries;
+
+  // the digits
+  int64_t nd;
+  int32_t cnt, n;
+  int32_t col, col1;
+  int32_t loc, stor[STOR_SIZE];
+  int32_t nChunk;  // digits produced per sweep, normally 1 (see '-k')
+  int64_t lChunk;  // 10^nChunk, the radix of each 'stor[]' entry
+  int32_t nSweeps; // sweeps done so far, each one produces 'nChunk' digits
+  int32_t nGuard;  // guard digits for the truncation (see 'series_len')
 #ifdef CHECK_LOC
-int32_t max_loc; // use for bounds-check
+  int32_t max_loc; // use for bounds-check
 #endif // CHECK_LOC
 
+  // the output ('out_open')
+  char *apOutRing[OUT_RING];
+  int32_t acbOutRing[OUT_RING];
+  volatile int32_t nOutHead, nOutTail; // blocks posted, blocks written
+  char *pOut;     // the block being filled, 'apOutRing[nOutHead % OUT_RING]'
+  int32_t cbOut;  // and how much of it is
+  FILE *pfOut;    // where the blocks go
+  int bOutPacked; // '-o', packed digits in a file
+  int bOutOdd;    // the last packed byte only has its high digit so far
+  PI_DIGITS_CB pfnOutDigits; // the library's callback ('pi_engine_run'), NULL for a file
+  int bOutQuiet;             // no header and no ' 3.' on stdout (the library and '--bench')
+  void *pOutUser;            // and what it gets passed
+#ifdef USE_THREAD
+  pthread_t idOutThread;
+  pthread_mutex_t mtxOut;
+  pthread_cond_t condOut;
+  int bOutThread, bOutExit;
+
+  // the per-series workers ('MyCreateThread') and the threaded split
+  SERIES_WORKER aWorkers[MAX_SERIES]; // [0] isn't used, that's the main thread
+  int nWorkers;                       // how many are running
+  int bHasWorker, bNoWorker;
+  int32_t nLagSplit;       // the split for the current sweep, 0 if its top half isn't done
+  uint64_t ullLagCarry;    // the carry out of the current sweep's top half
+#endif // USE_THREAD
+
+  // the wavefront engine ('tile_run')
+  int nTileThreads;          // '-t', zero if the wavefront engine isn't used
+  int32_t nTileBlock;        // '-b', terms per block
+  int32_t nTileDepth;        // '-d', sweeps per batch
+  int32_t nTileBlocks;       // number of blocks
+  int32_t nTileBatches;      // number of batches the engine runs
+#ifdef USE_THREAD
+  TILE_WORKER *pTileWorkers;
+#endif // USE_THREAD
+
+  // the Chudnovsky engine
+  int nChudThreads;    // cores to use, the split tree and the NTT use them
+  int nChudMaxThreads; // at most this many if it's not 0 ('--bench')
+
+  // checkpoints and telemetry, which only 'main' turns on
+  int32_t nCkptSecs;         // '-s', 0 for no checkpoints
+  unsigned int dwCkptTick;   // when the last one was taken
+  int bTelemetry;            // the compute threads time themselves
+  volatile int32_t nTelemLen; // series 0 terms in the current sweep
+
+  // a failed run ('run_fail')
+  jmp_buf jbRun;             // in 'pi_engine_run'
+  volatile int nRunErr;      // the 'memerr' code the run failed with, 0 if it hasn't
+};
+
 
 #ifndef _WIN32 /* assume NOT a 16-bit compile */
 unsigned int MyGetTickCount()
@@ -131,459 +348,6585 @@ struct timeval tv;
 }
 #endif  // _WIN32
 
-__inline void shift(int32_t FAR * l1, int32_t FAR * l2, int32_t lp, int32_t lmod)
+// a monotonic clock in nanoseconds, for timing things much shorter than a 'GetTickCount'
+// ('--tune' and '--bench')
+
+uint64_t ns_clock(void)
 {
-register int32_t k, k0, k1;
+#ifdef _WIN32
+LARGE_INTEGER li, liFreq;
 
+  QueryPerformanceCounter(&li);
+  QueryPerformanceFrequency(&liFreq);
 
-  k0 = *l2;
+  return (uint64_t)((double)li.QuadPart * 1e9 / (double)liFreq.QuadPart);
+#else  // _WIN32
+struct timespec ts;
 
-  if(*l2 > 0)
-  {
-#ifdef _WIN32 /* 32-bit windows */
-    k = k0;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif // _WIN32
+}
 
-    _asm mov eax, k
-    _asm mov edx, 0
-    _asm div lmod
-    _asm mov k1, edx
-    _asm mov k, eax
+// PHASE TIMES ('--bench') - where a run's time goes, in nanoseconds, when 'bPhaseTimes' is
+// set.  For the spigot it's the sweeps, 'shift1' and 'xprint' combining their digits, and
+// writing the output.  The Chudnovsky engine's are the binary splitting, the square root
+// and division, and turning the result into digits plus writing them.
 
-    *l2 = k1;  //remainder
-#else // #elif defined(ARCH_AMD64) || defined(ARCH_X86)
-    k = k0;
-    k1 = lmod; // hand optimization
+#define PH_SWEEP 0
+#define PH_COMBINE 1
+#define PH_OUTPUT 2
+#define PH_COUNT 3
 
-    {
-      register u_int32_t q = k / k1, r = k % k1;
+int bPhaseTimes;
+uint64_t aullPhaseNs[PH_COUNT];
 
-      k = q;
-      *l2 = r;
-    }
-//#else
-//    k = k0 / lmod;
-//    *l2 -= k * lmod; // the remainder (the old way)
-#endif // _WIN32
+// TELEMETRY ('-i' and '-I') - a thread of its own wakes up every so often, reads the
+// counters below and reports them on stderr and/or in the shared memory segment (see
+// 'PI_STATS' in pi.h).  The compute threads never wait for it or write anything it
+// shares, all they do when it's on is add up their own busy time:  slot 0 is the main
+// thread, the series workers use their series number and the wavefront workers theirs.
+// Each slot has a cache line to itself so the adds don't bounce between cores.
 
-  }
-  else
-  {
-#ifdef _WIN32
-    k = k0;
+typedef struct _TELEM_SLOT_
+{
+  volatile uint64_t ullBusyNs;
+  char pad[64 - sizeof(uint64_t)];
+} TELEM_SLOT;
 
-    _asm mov eax, k
-    _asm neg eax
-    _asm mov edx, 0
-    _asm div lmod
-    _asm mov k1, edx
-    _asm inc eax
-    _asm neg eax
-    _asm mov k, eax
+TELEM_SLOT aTelemSlots[PI_STATS_THREADS];
+volatile int nTelemThreads;          // highest slot used + 1
 
-    *l2 = lmod - k1;
-#else // #elif defined(ARCH_AMD64) || defined(ARCH_X86)
-    // NOTE:  for best optimization, use -O2 and gcc SHOULD make it efficient
-    k = -(k0);
-    k1 = lmod;
+// adds the time since 'ullT0' to slot 'nSlot'
 
-    {
-      register u_int32_t q = k / k1, r = k % k1;
+void telem_busy(int nSlot, uint64_t ullT0)
+{
+  if(nSlot < PI_STATS_THREADS)
+  {
+    aTelemSlots[nSlot].ullBusyNs += ns_clock() - ullT0;
 
-      k = -(q) - 1;
-      *l2 = k1 - r;
+    if(nSlot >= nTelemThreads)
+    {
+      nTelemThreads = nSlot + 1;
     }
-//#else
-//    k = -(-(k0) / lmod) - 1; // ensure truncation as positive number
-//    *l2 -= k * lmod; // the remainder (the old way)
-#endif // _WIN32
-
   }
+}
 
-  //original code
-  // k = ((*l2) > 0 ? (*l2) / lmod : -(-(*l2) / lmod) - 1);
-  // *l2 -= k * lmod;
+// TERM MEMORY ('-m') - where the term arrays (and the '-r' tables) live.
+//   heap    plain 'Fcalloc', the default
+//   thp     anonymous 'mmap', 2 MB aligned, with MADV_HUGEPAGE to ask for transparent huge
+//           pages.  A sweep over a few hundred MB of terms then takes a TLB miss every 2 MB
+//           instead of every 4 KB
+//   huge    explicit huge pages (MAP_HUGETLB, they have to be reserved first in
+//           /proc/sys/vm/nr_hugepages), falls back to 'thp' if there aren't enough
+//   <dir>   anything else is a directory.  The arrays are mapped from files there (deleted
+//           as soon as they're mapped) so a run bigger than RAM pages to and from the
+//           disk instead of dying in 'memerr'.  The kernel is told the access is
+//           sequential, which is what every sweep is
+// Everything but 'heap' needs 'mmap', so the WIN32 build only has 'heap'.
 
+#define TERM_HEAP 0
+#define TERM_THP 1
+#define TERM_HUGE 2
+#define TERM_FILE 3
 
-  *l1 += k * lp;
-}
+#define HUGE_PAGE_SIZE (2L * 1024L * 1024L)
 
-__inline void shift1(int32_t FAR * l1, int32_t FAR * l2, int32_t lmod)
+typedef struct _TERM_MAP_
 {
-register int32_t k, k0, k1;
+  void FAR * p;  // what 'term_alloc' returned, NULL if the slot is free
+  void *pBase;   // the mapping itself
+  Size_T cb;     // and its size
+} TERM_MAP;
 
+// every mapping starts on the same page boundary, and a sweep of two series side by side
+// would hit the same cache sets on every step.  So each one is shifted a little
+#define TERM_STAGGER 320
 
-  k0 = *l2;
-
-  if(*l2 > 0)
-  {
-#ifdef _WIN32
-    k = k0;
-
-    _asm mov eax, k
-    _asm mov edx, 0
-    _asm div lmod
-    _asm mov k1, edx
-    _asm mov k, eax
+int nTermMem;                       // TERM_xxx
+const char *pTermDir;               // the directory for TERM_FILE
+TERM_MAP aTermMaps[2 * MAX_SERIES]; // the terms and the reciprocal tables
 
-    *l2 = k1;  //remainder
-#else // #elif defined(ARCH_AMD64) || defined(ARCH_X86)
-    k = k0;
-    k1 = lmod; // hand optimization
+// sets the kind of memory from the '-m' argument
 
-    {
-      register u_int32_t q = k / k1, r = k % k1;
+void set_term_mem(const char *pMode)
+{
+  pTermDir = NULL;
 
-      k = q;
-      *l2 = r;
-    }
-//#else  // _WIN32
-//    k = *l2 / lmod;
-//  *l2 -= k * lmod; // the remainder
-#endif // _WIN32
+  if(!strcmp(pMode, "heap"))
+  {
+    nTermMem = TERM_HEAP;
+  }
+  else if(!strcmp(pMode, "thp"))
+  {
+    nTermMem = TERM_THP;
+  }
+  else if(!strcmp(pMode, "huge"))
+  {
+    nTermMem = TERM_HUGE;
   }
   else
   {
+    nTermMem = TERM_FILE;
+    pTermDir = pMode;
+  }
+
 #ifdef _WIN32
-    k = k0;
+  if(nTermMem != TERM_HEAP)
+  {
+    fprintf(stderr, "NOTE:  '-m %s' needs 'mmap', using the heap\n", pMode);
+    nTermMem = TERM_HEAP;
+  }
+#endif // _WIN32
+}
+
+// 'cb' bytes of zeroed memory for terms, or NULL
 
-    _asm mov eax, k
-    _asm neg eax
-    _asm mov edx, 0
-    _asm div lmod
-    _asm mov k1, edx
-    _asm inc eax
-    _asm neg eax
-    _asm mov k, eax
+void FAR * term_alloc(Size_T cb)
+{
+#ifndef _WIN32
+void *p = MAP_FAILED;
+Size_T cbMap;
+char szName[4096];
+char *pc, *pAligned;
+int fd, i1;
+#endif // _WIN32
 
-    *l2 = lmod - k1;
-#else // #elif defined(ARCH_AMD64) || defined(ARCH_X86)
-    // NOTE:  for best optimization, use -O2 and gcc SHOULD make it efficient
-    k = -(k0);
-    k1 = lmod;
+  if(nTermMem == TERM_HEAP)
+  {
+    return Fcalloc(cb, (Size_T)1);
+  }
 
+#ifdef _WIN32
+  return NULL; // can't get here
+#else  // _WIN32
+  for(i1 = 0; aTermMaps[i1].p; i1++)
+  {
+    if(i1 == sizeof(aTermMaps) / sizeof(aTermMaps[0]) - 1)
     {
-      register u_int32_t q = k / k1, r = k % k1;
-
-      k = -(q) - 1;
-      *l2 = k1 - r;
+      return NULL;
     }
-//#else  // _WIN32
-//    k = -(-(*l2) / lmod) - 1; // ensure truncation as positive number
-//  *l2 -= k * lmod; // the remainder
-#endif // _WIN32
   }
 
-  //original code
-  // k = ((*l2) > 0 ? (*l2) / lmod : -(-(*l2) / lmod) - 1);
-  // *l2 -= k * lmod; // the remainder
+  cbMap = (cb + i1 * TERM_STAGGER + HUGE_PAGE_SIZE - 1) & ~(Size_T)(HUGE_PAGE_SIZE - 1);
 
+#ifdef MAP_HUGETLB
+  if(nTermMem == TERM_HUGE)
+  {
+    p = mmap(NULL, cbMap, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
 
-  *l1 += k;
-}
+    if(p == MAP_FAILED)
+    {
+      fprintf(stderr, "NOTE:  not enough huge pages reserved, using transparent ones\n");
+      nTermMem = TERM_THP;
+    }
+  }
+#else  // MAP_HUGETLB
+  nTermMem = nTermMem == TERM_HUGE ? TERM_THP : nTermMem;
+#endif // MAP_HUGETLB
 
-void yprint(int32_t m)
-{
-  if(cnt < n)
+  if(nTermMem == TERM_THP)
   {
-    if(++col == 11)
+    // a 2 MB aligned piece out of a mapping that's 2 MB bigger, the rest goes back
+    pc = (char *)mmap(NULL, cbMap + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if((void *)pc != MAP_FAILED)
     {
-      col = 1;
-      if(++col1 == 6)
-      {
-        col1 = 0;
-        printf("\n");
-        printf("%4ld", (long)(m % 10));
-      }
-      else
+      pAligned = (char *)(((uintptr_t)pc + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+
+      if(pAligned > pc)
       {
-        printf("%3ld", (long)(m % 10));
+        munmap(pc, pAligned - pc);
       }
+
+      munmap(pAligned + cbMap, (pc + HUGE_PAGE_SIZE) - pAligned);
+
+      p = pAligned;
+#ifdef MADV_HUGEPAGE
+      madvise(p, cbMap, MADV_HUGEPAGE);
+#endif // MADV_HUGEPAGE
     }
-    else
+  }
+  else if(nTermMem == TERM_FILE)
+  {
+    cbMap = cb + i1 * TERM_STAGGER;
+    snprintf(szName, sizeof(szName), "%s/pi_terms_XXXXXX", pTermDir);
+
+    if((fd = mkstemp(szName)) < 0)
     {
-      printf("%ld", (long)m);
+      fprintf(stderr, "\nCan't create a term file in '%s'\n", pTermDir);
+      return NULL;
     }
-    cnt++;
-  }
-}
 
-void xprint(int32_t m)
-{
-int32_t ii, wk, wk1;
+    unlink(szName); // it goes away with the mapping
 
-  if(m < 8)
-  {
-#ifdef CHECK_LOC
-    // boundary check for 'loc' within 'stor[]' array
-    if(loc < 0 || loc >= sizeof(stor) / sizeof(stor[0]))
+    if(!ftruncate(fd, (off_t)cbMap))
     {
-      fprintf(stderr, "ii out of bounds, %d\n", loc);
-      fflush(stderr);
-      exit(4);
+      p = mmap(NULL, cbMap, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
     }
-#endif  // CHECK_LOC
-    for(ii = 1; ii <= loc;)
+
+    close(fd);
+
+    if(p != MAP_FAILED)
     {
-      yprint(stor[(int)(ii++)]);
+      madvise(p, cbMap, MADV_SEQUENTIAL);
     }
-    loc = 0;
   }
-  else
-  {
-    if(m > 9)
-    {
-      wk = m / 10;
-      m %= 10;
 
-#ifdef CHECK_LOC
-      // boundary check for 'loc' within 'stor[]' array
-      if(loc < 0 || loc >= sizeof(stor) / sizeof(stor[0]))
-      {
-        fprintf(stderr, "wk1 out of bounds, %d\n", loc);
-        fflush(stderr);
-        exit(4);
-      }
-#endif  // CHECK_LOC
-      for(wk1 = loc; wk1 >= 1; wk1--)
-      {
-        wk += stor[(int)wk1];
-        stor[(int)wk1] = wk % 10;
-        wk /= 10;
-      }
-    }
-  }
-#ifdef CHECK_LOC
-  // boundary check for 'loc' within 'stor[]' array
-  if(loc < -1 || loc >= (sizeof(stor) / sizeof(stor[0]) - 1))
+  if(p == MAP_FAILED)
   {
-    fprintf(stderr, "loc out of bounds, %d\n", loc);
-    fflush(stderr);
-    exit(4);
+    return NULL;
   }
-#endif  // CHECK_LOC
 
-  stor[(int)(++loc)] = m;
+  aTermMaps[i1].p = (char *)p + i1 * TERM_STAGGER;
+  aTermMaps[i1].pBase = p;
+  aTermMaps[i1].cb = cbMap;
 
-#ifdef CHECK_LOC
-  if(loc > max_loc)
+  return aTermMaps[i1].p;
+#endif // _WIN32
+}
+
+void term_free(void FAR * p)
+{
+#ifndef _WIN32
+int i1;
+
+  for(i1 = 0; i1 < (int)(sizeof(aTermMaps) / sizeof(aTermMaps[0])); i1++)
   {
-    max_loc = loc;
+    if(aTermMaps[i1].p == p)
+    {
+      munmap(aTermMaps[i1].pBase, aTermMaps[i1].cb);
+      aTermMaps[i1].p = NULL;
+      return;
+    }
   }
-#endif // CHECK_LOC
+#endif // _WIN32
+
+  Ffree(p);
 }
 
-void memerr(int errno)
+// DEAD TAIL - a series only ever gets shorter (see 'series_len'), so the terms past its
+// current length are never touched again.  'term_trim' gives whole pages of them back to
+// the OS (MADV_DONTNEED) once there's at least TRIM_BYTES of them.  The peak is the same but
+// on average only about half of the terms are resident, which is what counts with several
+// runs on one box.  '*pcbKept' is how much of 'p' is still resident, it only goes down.
+
+#ifndef TRIM_BYTES // a small one (-DTRIM_BYTES=4096) trims all the time, for testing '-t'
+#define TRIM_BYTES (1024L * 1024L)
+#endif // TRIM_BYTES
+
+void term_trim(void FAR * p, Size_T cbLive, Size_T *pcbKept)
 {
-  printf("\a\nOut of memory error #%d\n", errno);
-  if(2 == errno)
-    Ffree(mf);
-#ifdef _WIN32
-  _exit(2);
-#else  // _WIN32
-  exit(2);
-#endif  // _WIN32
+#ifndef _WIN32
+uintptr_t uPage = (uintptr_t)sysconf(_SC_PAGESIZE);
+uintptr_t uStart = ((uintptr_t)p + cbLive + uPage - 1) & ~(uPage - 1);
+uintptr_t uEnd = ((uintptr_t)p + *pcbKept) & ~(uPage - 1);
 
+  if(p && uEnd > uStart && uEnd - uStart >= TRIM_BYTES)
+  {
+    madvise((void *)uStart, uEnd - uStart, MADV_DONTNEED);
+    *pcbKept = uStart - (uintptr_t)p;
+  }
+#else  // _WIN32
+  (void)p;
+  (void)cbLive;
+  (void)pcbKept;
+#endif // _WIN32
 }
 
-#ifdef USE_THREAD
-void *the_thread_proc(void *pArg)
+// 64-BIT TERMS - the divisor for term 'i' is (2i - 1) * 57121 for the 'ms' series, which
+// no longer fits in 32 bits past about 18,800 terms, and (term * 10 + carry) overflows a
+// LOT sooner than that.  That's what broke every run past roughly 8,900 digits.  So the
+// terms, divisors, and carries are all 64-bit now, and the '*= 10' is folded into 'shift'
+// (which is what lets '-k' use 10^k without a separate code path).
+//
+// Fast divide strategy:
+//  a) the initial terms are the only negative ones, so 'normalize_series' carries them
+//     once before the first sweep.  After that every dividend is non-negative and the
+//     sweep can use plain unsigned division, no sign tests and no floor fix-ups
+//  b) the largest possible dividend for term 'j' is known in advance (see 'sweep_limit')
+//     and it shrinks as 'j' goes down.  So each sweep is split into a top part that needs
+//     128-bit intermediates (only huge runs with a big '-k'), a middle part that needs a
+//     64-bit 'div', and a bottom part where a 32-bit 'div' will do.  A 32-bit 'div' is
+//     several times faster than a 64-bit one on a lot of CPUs, and for any run under a few
+//     thousand digits the WHOLE sweep is in the bottom part.  No per-term tests either.
+
+#if defined(__SIZEOF_INT128__)
+#define HAS_INT128
+#endif // __SIZEOF_INT128__
+
+// divides 'k0' by 'lmod', rounding toward minus infinity, and puts the (non-negative)
+// remainder in '*pr'.  returns the quotient.  Only used where the sign isn't known
+
+__inline int64_t floor_div(int64_t k0, int64_t lmod, int64_t *pr)
 {
-int32_t temp0s, ks2, temp2;
-int32_t *ps;
-int i = (int)(INTPTR)pArg;
+int64_t k, r;
 
-  temp2 = 2 * i - 1;
-  temp0s = temp2 * ks;
-  ks2 = ks << 1;
 
-  ps = ms + i;
+  k = k0 / lmod;
+  r = k0 - k * lmod;
 
-  if(i >= 2)
+  if(r < 0) // ensure truncation as positive number
   {
-    *(ps--) *= 10;
-    *ps *= 10;
+    k--;
+    r += lmod;
   }
 
-  for(; i >= 2; i--)
-  {
-    temp2 -= 2;
-    shift(ps, ps + 1, temp2, temp0s);
-    temp0s -= ks2;
-    if(i >= 2)
-    {
-      *(--ps) *= 10;
-    }
-  }
+  *pr = r;
+  return k;
+}
 
-  return NULL;
+// one term of a sweep:  multiplies '*l2' by 'lmul' (10, or 10^k with '-k') and adds in the
+// carry '*l1' from the term above.  the remainder mod 'lmod' stays in '*l2' and the quotient
+// times 'lp' becomes the carry for the next term down
+
+__inline void shift(uint64_t *l1, uint64_t FAR * l2, uint64_t lp, uint64_t lmod, uint64_t lmul)
+{
+register uint64_t k0, q;
+
+
+  k0 = *l2 * lmul + *l1;
+  q = k0 / lmod;
+
+  *l2 = k0 - q * lmod;
+  *l1 = q * lp;
+
+  //original code
+  // k = ((*l2) > 0 ? (*l2) / lmod : -(-(*l2) / lmod) - 1);
+  // *l2 -= k * lmod;
 }
 
-pthread_t MyCreateThread(int i)
+// 'shift' for terms where the dividend and divisor are known to fit in 32 bits
+
+__inline void shift32(uint64_t *l1, uint64_t FAR * l2, uint32_t lp, uint32_t lmod, uint32_t lmul)
 {
-pthread_t thr;
+register uint32_t k0, q;
 
-  if(!pthread_create(&thr, NULL, the_thread_proc, (void *)(INTPTR)i))
-  {
-    return thr;
-  }
 
-  return 0;
+  k0 = (uint32_t)*l2 * lmul + (uint32_t)*l1;
+  q = k0 / lmod;
+
+  *l2 = k0 - q * lmod;
+  *l1 = (uint64_t)q * lp;
 }
-#endif  // USE_THREAD
 
+#ifdef HAS_INT128
+// 'shift' with a 128-bit dividend, for terms where (term * lmul + carry) could overflow
+// 64 bits.  The quotient is always less than 2 * lmul so it still fits
 
-int main(int argc, char *argv[])
+__inline void shift128(uint64_t *l1, uint64_t FAR * l2, uint64_t lp, uint64_t lmod, uint64_t lmul)
 {
-#ifdef _WIN32
-unsigned long dwStartTick = GetTickCount();
-#else   // _WIN32
-unsigned long dwStartTick = MyGetTickCount();
-#endif // _WIN32
+unsigned __int128 k0;
+uint64_t q;
 
-int i = 0;
-char *endp;
 
-  mf = ms = NULL;
-  kf = ks = 0;
-  cnt = n = temp = nd = 0;
-  i = 0;
-  col = col1 = 0;
-  loc = 0;
-#ifdef CHECK_LOC
-  max_loc = 0;
-#endif  // CHECK_LOC
-  memset(stor, 0, sizeof(stor));
+  k0 = (unsigned __int128)*l2 * lmul + *l1;
+  q = (uint64_t)(k0 / lmod);
 
-  stor[i++] = 0;
-  if(argc < 2)
-  {
-    fprintf(stderr, "\nUsage: %s <number_of_digits>\n\n", argv[0]);
-    return (1);
-  }
+  *l2 = (uint64_t)(k0 - (unsigned __int128)q * lmod);
+  *l1 = q * lp;
+}
+#endif // HAS_INT128
 
-  n = strtol(argv[1], &endp, 10);
+// RECIPROCAL TABLES ('-r') - the divisor for term 'j' of a series is always (2j - 1) * kk,
+// the same on every sweep, yet every sweep pays a hardware 'div' for it.  With '-r' each
+// series gets a table of multiply-shift 'magic numbers' (the libdivide approach) built once
+// at startup, and the sweep does a 64x64->128 multiply and a shift instead of the divide.
+//
+// The dividend is always less than 2^63 (the 128-bit part of a sweep still divides) so the
+// round-up method works with a 64-bit magic number and no 'add' fix-up:  with L = ceil(log2
+// lmod), magic = ceil(2^(63 + L) / lmod) and q = ((k0 * magic) >> 64) >> (L - 1).  The shift
+// is recomputed from 'lmod' with a 'clz' so the table only needs 8 bytes per term.
 
-  if(NULL == (mf = (int32_t *) Fcalloc((Size_T) (n + 3L), (Size_T) sizeof(int32_t))))
-  {
-    memerr(1);
-  }
-  if(NULL == (ms = (int32_t *) Fcalloc((Size_T) (n + 3L), (Size_T) sizeof(int32_t))))
-  {
-    memerr(2);
-  }
-  printf("\nApproximation of PI to %ld digits\n", (long)n);
-  cnt = 0;
-  kf = 25;
-  ks = 57121L;
-  mf[1] = 1L;
+#ifdef HAS_INT128
+#define HAS_RECIP
+#endif // HAS_INT128
 
-#ifdef _WIN32
+#ifdef HAS_RECIP
+__inline int recip_shift(uint64_t lmod)
+{
+  return 63 - __builtin_clzll(lmod - 1); // L - 1
+}
 
-  // WIN32 addition - reduce priority down to 'background' level
-  SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_NORMAL - 1);
+uint64_t recip_magic(uint64_t lmod)
+{
+unsigned __int128 k0;
+uint64_t q;
 
-#endif  // _WIN32
+  k0 = (unsigned __int128)1 << (64 + recip_shift(lmod)); // 2^(63 + L)
+  q = (uint64_t)(k0 / lmod);
 
-  for(i = 2; i <= (int)n; i += 2)
+  if(k0 % lmod)
   {
-    mf[i] = -16L;
-    mf[i + 1] = 16L;
+    q++; // round UP
   }
-  for(i = 1; i <= (int)n; i += 2)
-  {
-    ms[i] = -4L;
-    ms[i + 1] = 4L;
-  }
-  printf("\n 3.");
-  while(cnt < n)
-  {
-    int32_t temp0f, temp0s;
-    int32_t kf2, ks2;
-    int32_t *pf, *ps;
 
-    i = (int)(n - cnt);
+  return q;
+}
 
-#ifdef USE_THREAD
-    if(i >= USE_THREAD)
-    {
-      void *pRval;
-      pthread_t iThread = MyCreateThread(i);
+// 'shift' using the reciprocal 'magic' for 'lmod' instead of a divide
 
-      if(!iThread) // didn't create the thread -- oops!
-      {
-        goto old_way;
-      }
+__inline void shiftr(uint64_t *l1, uint64_t FAR * l2, uint64_t lp, uint64_t lmod, uint64_t lmul,
+                     uint64_t magic)
+{
+register uint64_t k0, q;
 
-      temp = 2 * i - 1;
-      temp0f = temp * kf;
-      kf2 = kf << 1;
 
-      pf = mf + i;
+  k0 = *l2 * lmul + *l1;
+  q = (uint64_t)(((unsigned __int128)k0 * magic) >> 64) >> recip_shift(lmod);
 
-      if(i >= 2)
-      {
-        *(pf--) *= 10;
-        *pf *= 10;
-      }
+  *l2 = k0 - q * lmod;
+  *l1 = q * lp;
+}
 
-      for(; i >= 2; i--)
-      {
-        temp -= 2;
-        shift(pf, pf + 1, temp, temp0f);
-        temp0f -= kf2;
-        if(i >= 2)
-        {
-          *(--pf) *= 10;
-        }
-      }
+// builds the reciprocal table for terms 2 through 'i' of the series with divisor 'kk'
 
-      pthread_join(iThread, &pRval); // waits for thread to exit, then continues
-    }
-    else
-#endif // USE_THREAD
+uint64_t FAR * make_recip_table(int32_t i, int64_t kk)
+{
+uint64_t FAR * pr;
+int32_t j;
+
+  pr = (uint64_t *) term_alloc((Size_T) (i + 3L) * sizeof(uint64_t));
+
+  if(pr)
+  {
+    for(j = 2; j <= i; j++)
     {
-#ifdef USE_THREAD
-old_way:
-#endif // USE_THREAD
-      temp = 2 * i - 1;
-      temp0f = temp * kf;
-      kf2 = kf << 1;
-      temp0s = temp * ks;
-      ks2 = ks << 1;
+      pr[j] = recip_magic((2 * (uint64_t)j - 1) * kk);
+    }
+  }
 
-      pf = mf + i;
-      ps = ms + i;
+  return pr;
+}
+#endif // HAS_RECIP
 
-      if(i >= 2)
-      {
-        *(pf--) *= 10;
-        *pf *= 10;
-        *(ps--) *= 10;
-        *ps *= 10;
-      }
+// returns the highest term 'j' for which (term * lmul + carry) is certain to be <= 'llLimit'.
+// A term is less than lmod = (2j - 1) * kk and the incoming carry is less than 2 * lmul * lp
+// (the quotients are never more than lmul * kk / (kk - 1)) so the dividend is less than
+// lmul * (lmod + 4j) = lmul * (j * (2kk + 4) - kk)
 
-      for(; i >= 2; i--)
-      {
-        temp -= 2;
-        shift(pf, pf + 1, temp, temp0f);
-        shift(ps, ps + 1, temp, temp0s);
-        temp0f -= kf2;
-        temp0s -= ks2;
-        if(i >= 2)
-        {
-          *(--pf) *= 10;
-          *(--ps) *= 10;
+int32_t sweep_limit(uint64_t llLimit, int64_t kk, int64_t lmul)
+{
+uint64_t j = (llLimit / (uint64_t)lmul + (uint64_t)kk) / (uint64_t)(2 * kk + 4);
+
+  return j > 0x7fffffff ? 0x7fffffff : (int32_t)j;
+}
+
+// 'normalize_series' carries the initial (signed) terms of series 'pa' so that terms 2
+// through 'i' are non-negative remainders, which the unsigned sweeps depend on.  Term 1
+// can end up negative, but that one always goes through 'shift1'
+
+void normalize_series(int64_t FAR * pa, int32_t i, int64_t kk)
+{
+int64_t carry = 0, r;
+int64_t lp, lmod;
+
+
+  for(lp = 2 * (int64_t)i - 3, lmod = (2 * (int64_t)i - 1) * kk; i >= 2; i--)
+  {
+    carry = floor_div(pa[i] + carry, lmod, &r) * lp;
+    pa[i] = r;
+
+    lp -= 2;
+    lmod -= kk << 1;
+  }
+
+  pa[1] += carry;
+}
+
+// one sweep of series 'pa' over terms 'hi' down to 'lo' (lo >= 2), using the series' divisor
+// 'kk' and multiplying every term by 'lmul'.  '*pc' is the carry coming in from the term above
+// 'hi' (zero at the top of a sweep) and gets the carry going out of 'lo'.  'pr' is the series'
+// reciprocal table, or NULL to divide.  A whole sweep is 'hi' = the sweep length, 'lo' = 2,
+// but the wavefront engine ('-t') sweeps a block at a time
+
+void sweep_range(int64_t FAR * pa, int32_t hi, int32_t lo, int64_t kk, int64_t lmul,
+                 uint64_t FAR * pr, uint64_t *pc)
+{
+uint64_t carry = *pc;
+uint64_t lp, lmod, kk2;
+uint64_t FAR * pu;
+int32_t i, j32;
+#ifdef HAS_INT128
+int32_t j64;
+#endif // HAS_INT128
+
+
+  lp = 2 * (uint64_t)hi - 3;
+  lmod = (2 * (uint64_t)hi - 1) * kk;
+  kk2 = (uint64_t)kk << 1;
+  pu = (uint64_t FAR *)pa;
+
+  j32 = sweep_limit(0xffffffff, kk, lmul);
+
+  i = hi;
+
+#ifdef HAS_INT128
+  j64 = sweep_limit(INT64_MAX, kk, lmul);
+
+  for(; i > j64 && i >= lo; i--)
+  {
+    shift128(&carry, pu + i, lp, lmod, lmul);
+
+    lp -= 2;
+    lmod -= kk2;
+  }
+#endif // HAS_INT128 (otherwise '-k' was limited so this can't happen)
+
+#ifdef HAS_RECIP
+  if(pr) // reciprocal table for everything that's left
+  {
+    for(; i >= lo; i--)
+    {
+      shiftr(&carry, pu + i, lp, lmod, lmul, pr[i]);
+
+      lp -= 2;
+      lmod -= kk2;
+    }
+  }
+#endif // HAS_RECIP
+
+  for(; i > j32 && i >= lo; i--)
+  {
+    shift(&carry, pu + i, lp, lmod, lmul);
+
+    lp -= 2;
+    lmod -= kk2;
+  }
+
+  for(; i >= lo; i--)
+  {
+    shift32(&carry, pu + i, (uint32_t)lp, (uint32_t)lmod, (uint32_t)lmul);
+
+    lp -= 2;
+    lmod -= kk2;
+  }
+
+  *pc = carry;
+}
+
+// 'sweep_range' for both series at once.  Each term's carry depends on the one above it, so
+// a single series is one long chain of divides; running two independent chains in the same
+// loop lets the CPU overlap them.  The widths are picked for the series with the bigger
+// divisor ('kk2'), which is always wide enough for the other
+
+void sweep_range_pair(int64_t FAR * pa1, int64_t FAR * pa2, int32_t hi, int32_t lo,
+                      int64_t kk1, int64_t kk2, int64_t lmul,
+                      uint64_t FAR * pr1, uint64_t FAR * pr2, uint64_t *pc1, uint64_t *pc2)
+{
+uint64_t carry1 = *pc1, carry2 = *pc2;
+uint64_t lp, lmod1, lmod2, kk12, kk22;
+uint64_t FAR * pu1, FAR * pu2;
+int32_t i, j32;
+#ifdef HAS_INT128
+int32_t j64;
+#endif // HAS_INT128
+
+
+  lp = 2 * (uint64_t)hi - 3;
+  lmod1 = (2 * (uint64_t)hi - 1) * kk1;
+  lmod2 = (2 * (uint64_t)hi - 1) * kk2;
+  kk12 = (uint64_t)kk1 << 1;
+  kk22 = (uint64_t)kk2 << 1;
+  pu1 = (uint64_t FAR *)pa1;
+  pu2 = (uint64_t FAR *)pa2;
+
+  j32 = sweep_limit(0xffffffff, kk2, lmul);
+
+  i = hi;
+
+#ifdef HAS_INT128
+  j64 = sweep_limit(INT64_MAX, kk2, lmul);
+
+  for(; i > j64 && i >= lo; i--)
+  {
+    shift128(&carry1, pu1 + i, lp, lmod1, lmul);
+    shift128(&carry2, pu2 + i, lp, lmod2, lmul);
+
+    lp -= 2;
+    lmod1 -= kk12;
+    lmod2 -= kk22;
+  }
+#endif // HAS_INT128
+
+#ifdef HAS_RECIP
+  if(pr1 && pr2)
+  {
+    for(; i >= lo; i--)
+    {
+      shiftr(&carry1, pu1 + i, lp, lmod1, lmul, pr1[i]);
+      shiftr(&carry2, pu2 + i, lp, lmod2, lmul, pr2[i]);
+
+      lp -= 2;
+      lmod1 -= kk12;
+      lmod2 -= kk22;
+    }
+  }
+#endif // HAS_RECIP
+
+  for(; i > j32 && i >= lo; i--)
+  {
+    shift(&carry1, pu1 + i, lp, lmod1, lmul);
+    shift(&carry2, pu2 + i, lp, lmod2, lmul);
+
+    lp -= 2;
+    lmod1 -= kk12;
+    lmod2 -= kk22;
+  }
+
+  for(; i >= lo; i--)
+  {
+    shift32(&carry1, pu1 + i, (uint32_t)lp, (uint32_t)lmod1, (uint32_t)lmul);
+    shift32(&carry2, pu2 + i, (uint32_t)lp, (uint32_t)lmod2, (uint32_t)lmul);
+
+    lp -= 2;
+    lmod1 -= kk12;
+    lmod2 -= kk22;
+  }
+
+  *pc1 = carry1;
+  *pc2 = carry2;
+}
+
+// one whole sweep of series 'pa', terms 'i' down to 2.  Returns the new value of term 1
+// (multiplied, carry added), which the caller hands to 'shift1' to get the series' part
+// of the next digit
+
+int64_t sweep_series(int64_t FAR * pa, int32_t i, int64_t kk, int64_t lmul, uint64_t FAR * pr)
+{
+uint64_t carry = 0;
+
+  if(i >= 2)
+  {
+    sweep_range(pa, i, 2, kk, lmul, pr, &carry);
+  }
+
+  return pa[1] * lmul + (int64_t)carry;
+}
+
+// 'sweep_range_pair' for two series whose sweeps start at different terms ('hi1' and 'hi2').
+// The longer one runs by itself down to where the shorter one starts, then they run as a pair
+
+void sweep_range_two(int64_t FAR * pa1, int64_t FAR * pa2, int32_t hi1, int32_t hi2, int32_t lo,
+                     int64_t kk1, int64_t kk2, int64_t lmul,
+                     uint64_t FAR * pr1, uint64_t FAR * pr2, uint64_t *pc1, uint64_t *pc2)
+{
+  if(hi1 > hi2 && hi1 >= lo)
+  {
+    sweep_range(pa1, hi1, hi2 >= lo ? hi2 + 1 : lo, kk1, lmul, pr1, pc1);
+    hi1 = hi2;
+  }
+  else if(hi2 > hi1 && hi2 >= lo)
+  {
+    sweep_range(pa2, hi2, hi1 >= lo ? hi1 + 1 : lo, kk2, lmul, pr2, pc2);
+    hi2 = hi1;
+  }
+
+  if(hi1 >= lo)
+  {
+    sweep_range_pair(pa1, pa2, hi1, lo, kk1, kk2, lmul, pr1, pr2, pc1, pc2);
+  }
+}
+
+// 'sweep_range' for every series of the formula, two at a time (see 'sweep_range_pair').
+// Series 's' is swept from 'pLen[s]' or 'hi', whichever is lower, down to 'lo', with its
+// carry in 'pc[s]'.  The series are sorted by 'x', so the second of each pair always has
+// the bigger divisor
+
+void sweep_set(PI_ENGINE *pE, int32_t hi, int32_t lo, const int32_t *pLen, uint64_t *pc)
+{
+ARCTAN_SERIES *pS;
+int32_t h1, h2;
+int s;
+
+  for(s = 0; s + 1 < pE->nSeries; s += 2)
+  {
+    pS = pE->aSeries + s;
+    h1 = pLen[s] < hi ? pLen[s] : hi;
+    h2 = pLen[s + 1] < hi ? pLen[s + 1] : hi;
+
+    sweep_range_two(pS[0].pa, pS[1].pa, h1, h2, lo, pS[0].kk, pS[1].kk, pE->lChunk,
+                    pS[0].pr, pS[1].pr, pc + s, pc + s + 1);
+  }
+
+  if(s < pE->nSeries) // odd one out
+  {
+    pS = pE->aSeries + s;
+    h1 = pLen[s] < hi ? pLen[s] : hi;
+
+    if(h1 >= lo)
+    {
+      sweep_range(pS->pa, h1, lo, pS->kk, pE->lChunk, pS->pr, pc + s);
+    }
+  }
+}
+
+// 'sweep_series' for every series at once, for the single-thread case.  'pLen' has the
+// sweep lengths, 'pVal' gets the new values of term 1
+
+void sweep_all(PI_ENGINE *pE, const int32_t *pLen, int64_t *pVal)
+{
+uint64_t aCarry[MAX_SERIES];
+int s;
+
+  memset(aCarry, 0, sizeof(aCarry));
+
+  sweep_set(pE, INT32_MAX, 2, pLen, aCarry);
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    pVal[s] = pE->aSeries[s].pa[1] * pE->lChunk + (int64_t)aCarry[s];
+  }
+}
+
+// TERM COUNTS - each term of a series divides by 'kk' (x squared) so it's worth log10(kk)
+// digits:  1.40 for Machin's 1/5 series, but 4.76 for the 1/239 series.  The old code swept
+// BOTH series over n - cnt terms, which is what the 1/5 series needs plus about 40%, and
+// more than 3 times what the 1/239 series needs.  So now each series is allocated, and
+// swept, over just the terms it needs for the digits that are left to produce.
+//
+// Dropping a term loses less than one unit of the digit that far out, and it happens once
+// per term, so up to 'n' of those can pile up at the end.  'nGuard' (log10(n) + 3) extra
+// digits of terms cover that.  Lengths come from the number of SWEEPS, not the number of
+// digits printed, so they are known ahead of time (the wavefront engine and the threaded
+// split both depend on that) and they never go back up.
+
+int32_t series_len(PI_ENGINE *pE, int32_t r, double dLog, int32_t nMax)
+{
+int32_t nLen;
+
+  if(r < 0)
+  {
+    r = 0;
+  }
+
+  nLen = (int32_t)ceil((double)(r + pE->nGuard) / dLog) + 1;
+
+  return nLen < nMax ? nLen : nMax;
+}
+
+// 'series_len' for every series, with 'r' digits left to produce
+
+void series_lens(PI_ENGINE *pE, int32_t r, int32_t *pLen)
+{
+int s;
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    pLen[s] = series_len(pE, r, pE->aSeries[s].dLog, pE->aSeries[s].nLen);
+  }
+}
+
+// gives back what's past the sweep lengths in 'pLen' (see 'term_trim').  Only one thread
+// at a time may call this
+
+void trim_series(PI_ENGINE *pE, const int32_t *pLen)
+{
+int s;
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    term_trim(pE->aSeries[s].pa, (pLen[s] + 3L) * sizeof(int64_t), pE->aSeries[s].acbKept);
+    term_trim(pE->aSeries[s].pr, (pLen[s] + 3L) * sizeof(uint64_t), pE->aSeries[s].acbKept + 1);
+  }
+}
+
+// the last step of a sweep:  'k0' is term 1 after 'sweep_series' and 'lmod' is the series' x.
+// adds the quotient into the digit '*l1' and leaves the remainder in term 1
+
+__inline void shift1(int64_t *l1, int64_t FAR * l2, int64_t k0, int64_t lmod)
+{
+int64_t r;
+
+
+  *l1 += floor_div(k0, lmod, &r);
+  *l2 = r;
+}
+
+// OUTPUT - 'yprint' used to 'printf' every digit from inside the sweep loop.  Now the digits
+// are laid out straight into big blocks, and full blocks go through a small ring to a writer
+// thread that 'fwrite's each one whole, so the sweeps don't wait on the terminal or the disk.
+// The layout is the same as before, 10 digits to a group and 6 groups to a line.
+// '-o file' writes just the digits to 'file' instead, packed 2 to a byte (BCD, high nibble
+// first, an odd last digit is padded with 0xF).  Everything else still goes to stdout.
+
+void memerr(int errno);
+
+#ifdef USE_THREAD
+void *out_thread_proc(void *pArg)
+{
+PI_ENGINE *pE = (PI_ENGINE *)pArg;
+int32_t nSlot;
+uint64_t ullT0;
+
+  pthread_mutex_lock(&(pE->mtxOut));
+
+  for(;;)
+  {
+    while(pE->nOutTail == pE->nOutHead && !pE->bOutExit)
+    {
+      pthread_cond_wait(&(pE->condOut), &(pE->mtxOut));
+    }
+
+    if(pE->nOutTail == pE->nOutHead) // and told to exit
+    {
+      break;
+    }
+
+    nSlot = pE->nOutTail % OUT_RING;
+    pthread_mutex_unlock(&(pE->mtxOut));
+
+    ullT0 = bPhaseTimes ? ns_clock() : 0;
+    fwrite(pE->apOutRing[nSlot], 1, pE->acbOutRing[nSlot], pE->pfOut);
+
+    if(bPhaseTimes)
+    {
+      aullPhaseNs[PH_OUTPUT] += ns_clock() - ullT0;
+    }
+
+    pthread_mutex_lock(&(pE->mtxOut));
+    pE->nOutTail++;
+    pthread_cond_broadcast(&(pE->condOut));
+  }
+
+  pthread_mutex_unlock(&(pE->mtxOut));
+
+  return NULL;
+}
+#endif // USE_THREAD
+
+// hands the current block to the writer and starts the next one, waiting only if the
+// whole ring is still queued up
+
+void out_post(PI_ENGINE *pE)
+{
+uint64_t ullT0;
+
+  if(!pE->cbOut)
+  {
+    return;
+  }
+
+  if(pE->pfnOutDigits) // plain digits, straight to the callback on this thread
+  {
+    pE->pfnOutDigits(pE->pOutUser, pE->pOut, pE->cbOut, pE->cnt - pE->cbOut + 1);
+    pE->cbOut = 0;
+    return;
+  }
+
+#ifdef USE_THREAD
+  if(pE->bOutThread)
+  {
+    pE->acbOutRing[pE->nOutHead % OUT_RING] = pE->cbOut;
+
+    pthread_mutex_lock(&(pE->mtxOut));
+    pE->nOutHead++;
+    pthread_cond_broadcast(&(pE->condOut));
+
+    while(pE->nOutHead - pE->nOutTail >= OUT_RING)
+    {
+      pthread_cond_wait(&(pE->condOut), &(pE->mtxOut));
+    }
+
+    pthread_mutex_unlock(&(pE->mtxOut));
+
+    pE->pOut = pE->apOutRing[pE->nOutHead % OUT_RING];
+    pE->cbOut = 0;
+    return;
+  }
+#endif // USE_THREAD
+
+  ullT0 = bPhaseTimes ? ns_clock() : 0;
+  fwrite(pE->pOut, 1, pE->cbOut, pE->pfOut); // no writer, write it here
+  pE->cbOut = 0;
+
+  if(bPhaseTimes)
+  {
+    aullPhaseNs[PH_OUTPUT] += ns_clock() - ullT0;
+  }
+}
+
+// sets up the blocks and the writer.  'pName' is the '-o' file, or NULL for the usual
+// layout on stdout.  'llResume' is where the output stood at a checkpoint ('out_sync'),
+// or -1 for a new run, and 'nHalf' is the half written byte of '-o' if there was one.
+// returns 0 if the file can't be opened
+
+int out_open(PI_ENGINE *pE, const char *pName, int64_t llResume, int nHalf)
+{
+int i1;
+#ifndef _WIN32
+struct stat st;
+#endif // _WIN32
+
+  pE->pfOut = stdout;
+  pE->bOutPacked = 0;
+  pE->bOutOdd = 0;
+
+  if(pName)
+  {
+    if(NULL == (pE->pfOut = fopen(pName, llResume < 0 ? "wb" : "r+b")))
+    {
+      fprintf(stderr, "\nCan't %s '%s'\n", llResume < 0 ? "create" : "open", pName);
+      return (0);
+    }
+
+    pE->bOutPacked = 1;
+  }
+
+  // whatever was written after the checkpoint gets written again, so cut it off
+  if(llResume >= 0)
+  {
+    fflush(pE->pfOut);
+#ifndef _WIN32
+    if(!fstat(fileno(pE->pfOut), &st) && S_ISREG(st.st_mode))
+    {
+      if(st.st_size < llResume)
+      {
+        fprintf(stderr, "NOTE:  the output is shorter than it was at the checkpoint, appending anyway\n");
+      }
+      else if(!ftruncate(fileno(pE->pfOut), (off_t)llResume))
+      {
+        fseek(pE->pfOut, (long)llResume, SEEK_SET);
+      }
+    }
+#else  // _WIN32
+    fseek(pE->pfOut, 0L, SEEK_END);
+#endif // _WIN32
+  }
+
+  for(i1 = 0; i1 < OUT_RING; i1++)
+  {
+    pE->apOutRing[i1] = (char *)Fcalloc((Size_T)OUT_BLOCK, (Size_T)1);
+    if(!pE->apOutRing[i1])
+    {
+      memerr(MAX_SERIES + 4);
+    }
+  }
+
+  pE->nOutHead = pE->nOutTail = 0;
+  pE->pOut = pE->apOutRing[0];
+  pE->cbOut = 0;
+
+  if(pE->bOutPacked && llResume >= 0 && nHalf >= 0)
+  {
+    pE->pOut[pE->cbOut++] = (char)nHalf;
+    pE->bOutOdd = 1;
+  }
+
+#ifdef USE_THREAD
+  pthread_mutex_init(&(pE->mtxOut), NULL);
+  pthread_cond_init(&(pE->condOut), NULL);
+  pE->bOutExit = 0;
+  pE->bOutThread = !pE->pfnOutDigits && !pthread_create(&(pE->idOutThread), NULL, out_thread_proc, pE); // run anyway if it fails
+#endif // USE_THREAD
+
+  return (1);
+}
+
+// gets the output onto the disk, for a checkpoint.  An odd last digit of '-o' stays
+// behind in the block, it goes in '*pnHalf' (-1 if there isn't one).  returns how far
+// the output is, -1 if it's not a file
+
+int64_t out_sync(PI_ENGINE *pE, int *pnHalf)
+{
+#ifndef _WIN32
+struct stat st;
+#endif // _WIN32
+char cHalf = 0;
+
+  *pnHalf = -1;
+
+  if(pE->bOutPacked && pE->bOutOdd)
+  {
+    cHalf = pE->pOut[--pE->cbOut];
+    *pnHalf = (unsigned char)cHalf;
+  }
+
+  out_post(pE);
+
+#ifdef USE_THREAD
+  if(pE->bOutThread)
+  {
+    pthread_mutex_lock(&(pE->mtxOut));
+
+    while(pE->nOutTail != pE->nOutHead)
+    {
+      pthread_cond_wait(&(pE->condOut), &(pE->mtxOut));
+    }
+
+    pthread_mutex_unlock(&(pE->mtxOut));
+  }
+#endif // USE_THREAD
+
+  fflush(pE->pfOut);
+
+  if(*pnHalf >= 0)
+  {
+    pE->pOut[pE->cbOut++] = cHalf;
+  }
+
+#ifndef _WIN32
+  if(fstat(fileno(pE->pfOut), &st) || !S_ISREG(st.st_mode))
+  {
+    return -1;
+  }
+
+  return (int64_t)lseek(fileno(pE->pfOut), 0, SEEK_CUR);
+#else  // _WIN32
+  return (int64_t)ftell(pE->pfOut);
+#endif // _WIN32
+}
+
+// writes what's left and stops the writer
+
+void out_close(PI_ENGINE *pE)
+{
+int i1;
+
+  out_post(pE);
+
+#ifdef USE_THREAD
+  if(pE->bOutThread)
+  {
+    pthread_mutex_lock(&(pE->mtxOut));
+    pE->bOutExit = 1;
+    pthread_cond_broadcast(&(pE->condOut));
+    pthread_mutex_unlock(&(pE->mtxOut));
+
+    pthread_join(pE->idOutThread, NULL);
+    pE->bOutThread = 0;
+  }
+
+  pthread_cond_destroy(&(pE->condOut));
+  pthread_mutex_destroy(&(pE->mtxOut));
+#endif // USE_THREAD
+
+  if(pE->bOutPacked)
+  {
+    fclose(pE->pfOut);
+  }
+  else
+  {
+    fflush(pE->pfOut);
+  }
+
+  for(i1 = 0; i1 < OUT_RING; i1++)
+  {
+    Ffree(pE->apOutRing[i1]);
+    pE->apOutRing[i1] = NULL;
+  }
+
+  pE->pOut = NULL;
+}
+
+void yprint(PI_ENGINE *pE, int32_t m)
+{
+  if(pE->cnt < pE->n)
+  {
+    if(pE->pfnOutDigits)
+    {
+      if(pE->cbOut == OUT_BLOCK)
+      {
+        out_post(pE);
+      }
+
+      pE->pOut[pE->cbOut++] = (char)('0' + m);
+      pE->cnt++;
+      return;
+    }
+
+    if(pE->bOutPacked)
+    {
+      if(pE->bOutOdd)
+      {
+        pE->pOut[pE->cbOut - 1] = (char)((pE->pOut[pE->cbOut - 1] & 0xf0) | m);
+      }
+      else
+      {
+        if(pE->cbOut == OUT_BLOCK)
+        {
+          out_post(pE);
+        }
+
+        pE->pOut[pE->cbOut++] = (char)((m << 4) | 0x0f);
+      }
+
+      pE->bOutOdd = !pE->bOutOdd;
+      pE->cnt++;
+      return;
+    }
+
+    if(pE->cbOut > OUT_BLOCK - 8) // room for a line break and a digit
+    {
+      out_post(pE);
+    }
+
+    if(++pE->col == 11)
+    {
+      pE->col = 1;
+      if(++pE->col1 == 6)
+      {
+        pE->col1 = 0;
+        memcpy(pE->pOut + pE->cbOut, "\n   ", 4);
+        pE->cbOut += 4;
+      }
+      else
+      {
+        memcpy(pE->pOut + pE->cbOut, "  ", 2);
+        pE->cbOut += 2;
+      }
+    }
+
+    pE->pOut[pE->cbOut++] = (char)('0' + m % 10);
+    pE->cnt++;
+  }
+}
+
+// prints one 'stor[]' entry, which is a single digit unless '-k' was used, in
+// which case it is 'nChunk' digits (with leading zeros)
+
+void yprintk(PI_ENGINE *pE, int32_t m)
+{
+char tbuf[MAX_CHUNK];
+int i1;
+
+  if(pE->nChunk <= 1)
+  {
+    yprint(pE, m);
+    return;
+  }
+
+  for(i1 = pE->nChunk - 1; i1 >= 0; i1--)
+  {
+    tbuf[i1] = (char)(m % 10);
+    m /= 10;
+  }
+
+  for(i1 = 0; i1 < pE->nChunk; i1++)
+  {
+    yprint(pE, tbuf[i1]);
+  }
+}
+
+// 'm' is the next digit (or next chunk of 'nChunk' digits, radix 'lChunk').  It
+// is held in 'stor[]' until no carry can reach it.  A value >= the radix carries
+// into the held ones, and anything less than 'radix - nSeries' flushes them
+
+void xprint(PI_ENGINE *pE, int64_t m)
+{
+int32_t ii, wk1;
+int64_t wk;
+
+  // each series can still carry at most 1 into this chunk (its terms are all non-negative
+  // remainders now), so anything below 'lChunk - nSeries' can't carry out of it any more
+  if(m < pE->lChunk - pE->nSeries)
+  {
+#ifdef CHECK_LOC
+    // boundary check for 'loc' within 'stor[]' array
+    if(pE->loc < 0 || pE->loc >= sizeof(pE->stor) / sizeof(pE->stor[0]))
+    {
+      fprintf(stderr, "ii out of bounds, %d\n", pE->loc);
+      fflush(stderr);
+      exit(4);
+    }
+#endif  // CHECK_LOC
+    for(ii = 1; ii <= pE->loc;)
+    {
+      yprintk(pE, pE->stor[(int)(ii++)]);
+    }
+    pE->loc = 0;
+  }
+  else
+  {
+    if(m > pE->lChunk - 1)
+    {
+      wk = m / pE->lChunk;
+      m %= pE->lChunk;
+
+#ifdef CHECK_LOC
+      // boundary check for 'loc' within 'stor[]' array
+      if(pE->loc < 0 || pE->loc >= sizeof(pE->stor) / sizeof(pE->stor[0]))
+      {
+        fprintf(stderr, "wk1 out of bounds, %d\n", pE->loc);
+        fflush(stderr);
+        exit(4);
+      }
+#endif  // CHECK_LOC
+      for(wk1 = pE->loc; wk1 >= 1 && wk; wk1--) // the carry stops as soon as it's absorbed
+      {
+        wk += pE->stor[(int)wk1];
+        pE->stor[(int)wk1] = (int32_t)(wk % pE->lChunk);
+        wk /= pE->lChunk;
+      }
+    }
+  }
+#ifdef CHECK_LOC
+  // boundary check for 'loc' within 'stor[]' array
+  if(pE->loc < -1 || pE->loc >= (sizeof(pE->stor) / sizeof(pE->stor[0]) - 1))
+  {
+    fprintf(stderr, "loc out of bounds, %d\n", pE->loc);
+    fflush(stderr);
+    exit(4);
+  }
+#endif  // CHECK_LOC
+
+  pE->stor[(int)(++pE->loc)] = (int32_t)m;
+
+#ifdef CHECK_LOC
+  if(pE->loc > pE->max_loc)
+  {
+    pE->max_loc = pE->loc;
+  }
+#endif // CHECK_LOC
+}
+
+void free_series(PI_ENGINE *pE)
+{
+int s;
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    if(pE->aSeries[s].pr)
+    {
+      term_free(pE->aSeries[s].pr);
+      pE->aSeries[s].pr = NULL;
+    }
+    if(pE->aSeries[s].pa)
+    {
+      term_free(pE->aSeries[s].pa);
+      pE->aSeries[s].pa = NULL;
+    }
+  }
+}
+
+// RUN FAILURES - the program prints 'memerr' and exits, but a library can't take its host
+// down with it.  So in the library 'memerr' is 'run_fail':  the run is marked failed, and
+// the thread that hit it gets out.  'pi_engine_run' sets the engine's 'jbRun' up; its own
+// thread jumps back there, a helper thread ('run_spawn') exits, and whoever joins it
+// ('run_join') sees the failure and gets out too, all the way up.  Before any of them
+// leaves it joins the helpers it started, since they work in its stack.  What the failed
+// run allocated, apart from the terms, is lost; it's out of memory, after all.
+//
+// 'memerr' is called from deep in the bignum code, which doesn't know about engines, so
+// each thread of a run keeps a pointer to the engine it's working for in 'pRunEngine'.
+// The bignum code gets its thread count there too ('nChudThreads').
+
+#ifdef USE_THREAD
+#define RUN_KIDS 64            /* most helper threads one thread can have going */
+
+__thread PI_ENGINE *pRunEngine;        // the run this thread is part of, NULL for none
+__thread pthread_t aRunKids[RUN_KIDS]; // this thread's helpers that aren't joined yet
+__thread int nRunKids;
+__thread int bRunHelper;       // this is a helper, not the thread that called 'pi_engine_run'
+
+typedef struct _RUN_KID_
+{
+  void *(*pfnProc)(void *);
+  void *pArg;
+  PI_ENGINE *pE;
+} RUN_KID;
+
+void *run_kid_proc(void *pArg)
+{
+RUN_KID kid = *(RUN_KID *)pArg;
+
+  free(pArg);
+  bRunHelper = 1;
+  pRunEngine = kid.pE;
+
+  return kid.pfnProc(kid.pArg);
+}
+
+// 'pthread_create' for a helper of the run.  Returns non-zero if it started, zero if the
+// caller should do the work itself
+
+int run_spawn(pthread_t *pId, void *(*pfnProc)(void *), void *pArg)
+{
+RUN_KID *pKid;
+
+  if(nRunKids >= RUN_KIDS || NULL == (pKid = (RUN_KID *)malloc(sizeof(RUN_KID))))
+  {
+    return 0;
+  }
+
+  pKid->pfnProc = pfnProc;
+  pKid->pArg = pArg;
+  pKid->pE = pRunEngine;
+
+  if(pthread_create(pId, NULL, run_kid_proc, pKid))
+  {
+    free(pKid);
+    return 0;
+  }
+
+  aRunKids[nRunKids++] = *pId;
+  return 1;
+}
+
+// joins a helper from 'run_spawn', and gets out if the run has failed meanwhile
+
+void run_join(pthread_t idKid)
+{
+int i1;
+
+  pthread_join(idKid, NULL);
+
+  for(i1 = nRunKids - 1; i1 >= 0; i1--)
+  {
+    if(pthread_equal(aRunKids[i1], idKid))
+    {
+      aRunKids[i1] = aRunKids[--nRunKids];
+      break;
+    }
+  }
+
+  if(pRunEngine && pRunEngine->nRunErr)
+  {
+    memerr(pRunEngine->nRunErr);
+  }
+}
+#else  // USE_THREAD
+PI_ENGINE *pRunEngine;
+#endif // USE_THREAD
+
+#ifdef PI_LIBRARY
+void run_fail(int nErr)
+{
+  if(!pRunEngine->nRunErr)
+  {
+    pRunEngine->nRunErr = nErr;
+  }
+
+#ifdef USE_THREAD
+  while(nRunKids > 0) // they see 'nRunErr' when they join their own, or finish
+  {
+    pthread_join(aRunKids[--nRunKids], NULL);
+  }
+
+  if(bRunHelper)
+  {
+    pthread_exit(NULL);
+  }
+#endif // USE_THREAD
+
+  longjmp(pRunEngine->jbRun, 1);
+}
+#endif // PI_LIBRARY
+
+void memerr(int errno)
+{
+#ifdef PI_LIBRARY
+  run_fail(errno);
+#else  // PI_LIBRARY
+  printf("\a\nOut of memory error #%d\n", errno);
+
+  if(pRunEngine)
+  {
+    free_series(pRunEngine);
+  }
+#ifdef _WIN32
+  _exit(2);
+#else  // _WIN32
+  exit(2);
+#endif  // _WIN32
+#endif // PI_LIBRARY
+}
+
+#ifdef USE_THREAD
+
+// SWEEP GATE - a lightweight 'event' used to hand each sweep to the persistent
+// worker thread (and to hand it back again).  The poster bumps 'nSeq', and the
+// waiter spins on it for a short while before it falls back to a condition
+// variable.  At the sizes where the threaded path matters a sweep is done in
+// microseconds, so the spin nearly always catches it and the handoff costs about
+// as much as moving one cache line between cores.  This replaces the old
+// 'pthread_create' and 'pthread_join' for every digit.
+
+#define GATE_SPIN 4000 /* spin iterations before blocking on the condition */
+
+#if defined(ARCH_AMD64) || defined(ARCH_X86)
+#define CPU_RELAX() __builtin_ia32_pause()
+#else  // other architectures
+#define CPU_RELAX() do { } while(0)
+#endif // ARCH_AMD64, ARCH_X86
+
+void gate_init(SWEEP_GATE *pG)
+{
+  pG->nSeq = 0;
+  pG->nWaiters = 0;
+  pthread_mutex_init(&(pG->mtx), NULL);
+  pthread_cond_init(&(pG->cond), NULL);
+}
+
+void gate_destroy(SWEEP_GATE *pG)
+{
+  pthread_cond_destroy(&(pG->cond));
+  pthread_mutex_destroy(&(pG->mtx));
+}
+
+void gate_post(SWEEP_GATE *pG)
+{
+  __atomic_add_fetch(&(pG->nSeq), 1, __ATOMIC_SEQ_CST);
+
+  // only take the mutex if somebody actually went to sleep
+  if(__atomic_load_n(&(pG->nWaiters), __ATOMIC_SEQ_CST))
+  {
+    pthread_mutex_lock(&(pG->mtx));
+    pthread_cond_broadcast(&(pG->cond));
+    pthread_mutex_unlock(&(pG->mtx));
+  }
+}
+
+// waits until the gate's sequence differs from 'nSeen', returns the new sequence
+
+unsigned int gate_wait(SWEEP_GATE *pG, unsigned int nSeen)
+{
+unsigned int nSeq;
+int i1;
+
+  for(i1 = 0; i1 < GATE_SPIN; i1++)
+  {
+    nSeq = __atomic_load_n(&(pG->nSeq), __ATOMIC_ACQUIRE);
+
+    if(nSeq != nSeen)
+    {
+      return nSeq;
+    }
+
+    CPU_RELAX();
+  }
+
+  pthread_mutex_lock(&(pG->mtx));
+  __atomic_add_fetch(&(pG->nWaiters), 1, __ATOMIC_SEQ_CST);
+
+  while((nSeq = __atomic_load_n(&(pG->nSeq), __ATOMIC_SEQ_CST)) == nSeen)
+  {
+    pthread_cond_wait(&(pG->cond), &(pG->mtx));
+  }
+
+  __atomic_sub_fetch(&(pG->nWaiters), 1, __ATOMIC_SEQ_CST);
+  pthread_mutex_unlock(&(pG->mtx));
+
+  return nSeq;
+}
+
+// PER-SERIES WORKERS - each series of the formula after the first gets a persistent worker
+// of its own, and the main thread does series 0 (the longest one), so a 4-term formula
+// keeps 4 cores busy.  The workers are all handed the same sweep at once and the main
+// thread waits for all of them before it combines the digits.
+
+int32_t nThreadMin = USE_THREAD;    // the shortest series 0 sweep that's threaded (see 'tune_run')
+
+void MyDestroyThread(PI_ENGINE *pE);
+
+// a worker runs its series' sweep every time 'gateStart' is posted, using the length
+// in 'nLen', then posts 'gateDone'.  A length of zero means 'exit'.  The last one may
+// also do the top of the NEXT series 0 sweep, see 'threaded_sweep'
+
+void *the_thread_proc(void *pArg)
+{
+SERIES_WORKER *pW = (SERIES_WORKER *)pArg;
+PI_ENGINE *pE = pW->pE;
+ARCTAN_SERIES *pS = pE->aSeries + pW->nIndex;
+unsigned int nSeen = 0;
+uint64_t ullT0;
+int i;
+
+  for(;;)
+  {
+    nSeen = gate_wait(&(pW->gateStart), nSeen);
+
+    i = (int)pW->nLen;
+    if(i <= 0)
+    {
+      break;
+    }
+
+    ullT0 = pE->bTelemetry ? ns_clock() : 0;
+
+    pW->llVal = sweep_series(pS->pa, i, pS->kk, pE->lChunk, pS->pr);
+
+    pW->ullCarry = 0;
+
+    if(pW->nUpHi >= pW->nUpLo)
+    {
+      sweep_range(pE->aSeries[0].pa, pW->nUpHi, pW->nUpLo, pE->aSeries[0].kk, pE->lChunk, pE->aSeries[0].pr,
+                  &(pW->ullCarry));
+    }
+
+    if(pE->bTelemetry)
+    {
+      telem_busy(pW->nIndex, ullT0);
+    }
+
+    gate_post(&(pW->gateDone));
+  }
+
+  return NULL;
+}
+
+// creates the persistent workers the first time they are needed; returns non-zero if
+// they are running
+
+int MyCreateThread(PI_ENGINE *pE)
+{
+SERIES_WORKER *pW;
+int i1;
+
+  if(pE->bHasWorker)
+  {
+    return 1;
+  }
+
+  // with only one CPU the workers would just steal time (and spin) from the
+  // main thread, so don't bother
+  if(pE->bNoWorker || pE->nSeries < 2 || sysconf(_SC_NPROCESSORS_ONLN) < 2)
+  {
+    pE->bNoWorker = 1;
+    return 0;
+  }
+
+  for(pE->nWorkers = 0, i1 = 1; i1 < pE->nSeries; i1++)
+  {
+    pW = pE->aWorkers + i1;
+
+    gate_init(&(pW->gateStart));
+    gate_init(&(pW->gateDone));
+    pW->nLen = 0;
+    pW->nUpHi = pW->nUpLo = 0;
+    pW->nDoneSeen = 0;
+    pW->nIndex = i1;
+    pW->pE = pE;
+
+    if(pthread_create(&(pW->idThread), NULL, the_thread_proc, pW))
+    {
+      gate_destroy(&(pW->gateStart));
+      gate_destroy(&(pW->gateDone));
+      break;
+    }
+
+    pE->nWorkers++;
+  }
+
+  pE->bHasWorker = 1;
+
+  if(pE->nWorkers < pE->nSeries - 1) // run anyway, without them
+  {
+    MyDestroyThread(pE);
+    pE->bNoWorker = 1;
+    return 0;
+  }
+
+  return 1;
+}
+
+void MyDestroyThread(PI_ENGINE *pE)
+{
+SERIES_WORKER *pW;
+int i1;
+
+  if(!pE->bHasWorker)
+  {
+    return;
+  }
+
+  for(i1 = 1; i1 <= pE->nWorkers; i1++)
+  {
+    pW = pE->aWorkers + i1;
+
+    pW->nLen = 0; // tells it to exit
+    gate_post(&(pW->gateStart));
+
+    pthread_join(pW->idThread, NULL);
+
+    gate_destroy(&(pW->gateStart));
+    gate_destroy(&(pW->gateDone));
+  }
+
+  pE->nWorkers = 0;
+  pE->bHasWorker = 0;
+}
+
+// THREADED SPLIT - with each series swept only as far as it needs, series 0 is by far the
+// longest (for Machin's formula the 1/239 series is less than a third as long as the 1/5
+// one), so giving each worker one series leaves the LAST worker (the shortest series) idle
+// most of the time.  But series 0 can't be split in the middle of a sweep, since the
+// bottom half needs the carry from the top half.
+//
+// So the split runs one sweep AHEAD:  while the main thread does the bottom of series 0
+// (terms 'nLagSplit' down to 2) for this sweep, using the carry the last worker left from
+// the top half, that worker does all of its own series for this sweep AND the top of
+// series 0 (above the new split) for the NEXT sweep.  The split is picked so both sides do
+// about the same work.  The two halves can't overlap, so the split can only move up while
+// running ahead; when it needs to move DOWN (the sweeps keep getting shorter) there's one
+// step without the look-ahead and the main thread does the next top half itself.
+
+// the split that balances 'lf' terms of series 0 against 'ls' terms of the last series
+
+int32_t balance_split(int32_t lf, int32_t ls)
+{
+int32_t nSplit = (lf + ls + 1) / 2; // main:  nSplit - 1 terms, worker:  ls + lf - nSplit
+
+  return nSplit < lf ? nSplit : lf;
+}
+
+// one sweep using the workers.  'pLen' has this sweep's lengths and 'pLen1' the next
+// sweep's, or NULL if the next sweep won't use the workers.  'pVal' gets term 1 of each
+// series (see 'sweep_all')
+
+void threaded_sweep(PI_ENGINE *pE, const int32_t *pLen, const int32_t *pLen1, int64_t *pVal)
+{
+ARCTAN_SERIES *pS0 = pE->aSeries;
+SERIES_WORKER *pW, *pLag = pE->aWorkers + pE->nSeries - 1; // the one that does the top of series 0
+int32_t nSplit, nNext, nIdeal, lf, lf1;
+uint64_t carry, ullT0;
+int i1;
+
+
+  lf = pLen[0];
+  ullT0 = pE->bTelemetry ? ns_clock() : 0;
+
+  if(!pE->nLagSplit) // top half of this sweep wasn't done ahead of time, do it now
+  {
+    pE->nLagSplit = balance_split(lf, pLen[pE->nSeries - 1]);
+    pE->ullLagCarry = 0;
+
+    if(lf > pE->nLagSplit)
+    {
+      sweep_range(pS0->pa, lf, pE->nLagSplit + 1, pS0->kk, pE->lChunk, pS0->pr, &(pE->ullLagCarry));
+    }
+  }
+
+  nSplit = pE->nLagSplit;
+  carry = pE->ullLagCarry;
+
+  // the split for the next sweep - keep it if it's close enough, move it up if need be,
+  // and if it has to come down skip the look-ahead this time
+  nNext = 0;
+  lf1 = pLen1 ? pLen1[0] : 0;
+
+  if(lf1)
+  {
+    nIdeal = balance_split(lf1, pLen1[pE->nSeries - 1]);
+
+    if(nIdeal >= nSplit)
+    {
+      nNext = nIdeal;
+    }
+    else if(nSplit <= lf1 && nIdeal + nIdeal / 8 >= nSplit)
+    {
+      nNext = nSplit; // within 1/8, leave it alone
+    }
+  }
+
+  for(i1 = 1; i1 < pE->nSeries; i1++)
+  {
+    pW = pE->aWorkers + i1;
+
+    pW->nLen = pLen[i1];
+    pW->nUpHi = (pW == pLag && nNext) ? lf1 : 0;
+    pW->nUpLo = (pW == pLag && nNext) ? nNext + 1 : 1;
+
+    gate_post(&(pW->gateStart)); // workers sweep their series while I do the bottom of mine
+  }
+
+  if(nSplit >= 2)
+  {
+    sweep_range(pS0->pa, nSplit, 2, pS0->kk, pE->lChunk, pS0->pr, &carry);
+  }
+
+  pVal[0] = pS0->pa[1] * pE->lChunk + (int64_t)carry;
+
+  if(pE->bTelemetry) // not counting the wait for the workers
+  {
+    telem_busy(0, ullT0);
+  }
+
+  for(i1 = 1; i1 < pE->nSeries; i1++) // waits for the workers' sweeps to finish
+  {
+    pW = pE->aWorkers + i1;
+
+    pW->nDoneSeen = gate_wait(&(pW->gateDone), pW->nDoneSeen);
+    pVal[i1] = pW->llVal;
+  }
+
+  pE->nLagSplit = nNext;
+  pE->ullLagCarry = pLag->ullCarry;
+}
+#endif  // USE_THREAD
+
+// WAVEFRONT ENGINE ('-t') - every digit used to stream ALL of every series from the top
+// down to term 1.  At a million digits that's several MB per sweep, straight from DRAM,
+// and at most one core per series can work on it.  But the carries only ever flow
+// DOWN, so sweep d+1 can start on a block of terms as soon as sweep d has left it.
+//
+// So the terms are cut into blocks of 'nTileBlock' and the sweeps into batches of
+// 'nTileDepth'.  A batch takes each block in turn (top to bottom) and runs ALL of its
+// sweeps over that block while it is still in cache, keeping one carry per sweep.  With
+// 'nTileThreads' > 1 the batches are dealt out round-robin and pipelined:  a thread starts
+// a block as soon as the previous batch (on the previous thread) has finished it.  The
+// batch that finishes the bottom block does term 1 and the digits, which keeps them in
+// order, since that batch can't finish until the one before it has.
+//
+// The sweep lengths have to be known ahead of time, which they are (see 'series_len').
+// The engine stops while the sweeps are still long; the rest are short, and done the
+// usual way, carrying on from 'nSweeps'.
+//
+// Batches on other threads still use terms past this batch's sweeps, so the dead tail it
+// gives back is only what's past the oldest one (see 'tile_batch').  To check that, build
+// with -DTRIM_BYTES=4096 and compare 'pi -t 8 -b 512 -d 2 -k 9 100000' and
+// 'pi -t 4 -b 1024 -d 4 -k 9 -r 100000' with a plain 'pi 100000'.
+
+#define MAX_TILE_DEPTH 64        /* most sweeps per batch */
+#define DEFAULT_TILE_BLOCK 8192  /* terms per block, 8192 * 2 series * 8 bytes = 128KB */
+#define DEFAULT_TILE_DEPTH 16    /* sweeps per batch */
+
+#ifdef USE_THREAD
+// waits until batch 'm' (done by worker 'm % nTileThreads') has finished 'nBlocks' blocks
+
+void tile_wait(PI_ENGINE *pE, int32_t m, int32_t nBlocks)
+{
+TILE_WORKER *pW = pE->pTileWorkers + (m % pE->nTileThreads);
+int64_t llTarget = (int64_t)m * pE->nTileBlocks + nBlocks;
+unsigned int nSeq;
+
+  for(;;)
+  {
+    nSeq = __atomic_load_n(&(pW->gate.nSeq), __ATOMIC_ACQUIRE);
+
+    if(__atomic_load_n(&(pW->llDone), __ATOMIC_ACQUIRE) >= llTarget)
+    {
+      return;
+    }
+
+    gate_wait(&(pW->gate), nSeq);
+  }
+}
+#endif // USE_THREAD
+
+// runs batch 'm' over every block, top to bottom
+
+void tile_batch(PI_ENGINE *pE, int32_t m)
+{
+uint64_t aCarry[MAX_TILE_DEPTH][MAX_SERIES];
+int32_t aLen[MAX_TILE_DEPTH][MAX_SERIES];
+int32_t b, d, hi, lo, s0;
+int64_t ndk;
+uint64_t ullT0;
+int s;
+#ifdef USE_THREAD
+TILE_WORKER *pW = pE->pTileWorkers + (m % pE->nTileThreads);
+#endif // USE_THREAD
+
+
+  s0 = m * pE->nTileDepth;
+
+  memset(aCarry, 0, sizeof(aCarry));
+
+  for(d = 0; d < pE->nTileDepth; d++)
+  {
+    series_lens(pE, pE->n - (s0 + d) * pE->nChunk, aLen[d]); // digits left to produce before this sweep
+  }
+
+  // the oldest batch that can still be running is m - nTileThreads + 1 (on the next thread,
+  // batch m - nTileThreads was this thread's and it's finished), and the sweeps only get
+  // shorter, so nothing past the first sweep of THAT batch is needed any more.  Only one
+  // thread trims
+  if(m % pE->nTileThreads == 0)
+  {
+    int32_t aTrim[MAX_SERIES];
+
+    series_lens(pE, pE->n - (m > pE->nTileThreads - 1 ? m - pE->nTileThreads + 1 : 0) * pE->nTileDepth * pE->nChunk, aTrim);
+    trim_series(pE, aTrim);
+    pE->nTelemLen = aLen[0][0];
+  }
+
+  for(b = 0; b < pE->nTileBlocks; b++)
+  {
+    hi = pE->aSeries[0].nLen - b * pE->nTileBlock;
+    lo = hi - pE->nTileBlock + 1;
+
+    if(lo < 2 || b == pE->nTileBlocks - 1)
+    {
+      lo = 2;
+    }
+
+#ifdef USE_THREAD
+    if(m > 0 && pE->nTileThreads > 1)
+    {
+      tile_wait(pE, m - 1, b + 1); // the previous batch has to be done with this block
+    }
+#endif // USE_THREAD
+
+    ullT0 = pE->bTelemetry ? ns_clock() : 0;
+
+    for(d = 0; d < pE->nTileDepth; d++)
+    {
+      sweep_set(pE, hi, lo, aLen[d], aCarry[d]);
+    }
+
+    if(pE->bTelemetry) // not counting the wait for the batch ahead
+    {
+      telem_busy(m % pE->nTileThreads, ullT0);
+    }
+
+    if(b == pE->nTileBlocks - 1) // the bottom - term 1 and the digits, in sweep order
+    {
+      for(d = 0; d < pE->nTileDepth; d++)
+      {
+        ndk = 0;
+
+        for(s = 0; s < pE->nSeries; s++)
+        {
+          shift1(&ndk, pE->aSeries[s].pa + 1, pE->aSeries[s].pa[1] * pE->lChunk + (int64_t)aCarry[d][s],
+                 pE->aSeries[s].x);
+        }
+
+        xprint(pE, ndk);
+      }
+    }
+
+#ifdef USE_THREAD
+    if(pE->nTileThreads > 1)
+    {
+      __atomic_store_n(&(pW->llDone), (int64_t)m * pE->nTileBlocks + b + 1, __ATOMIC_RELEASE);
+      gate_post(&(pW->gate));
+    }
+#endif // USE_THREAD
+  }
+}
+
+#ifdef USE_THREAD
+void *tile_thread_proc(void *pArg)
+{
+TILE_WORKER *pW = (TILE_WORKER *)pArg;
+PI_ENGINE *pE = pW->pE;
+int32_t m;
+
+  for(m = pW->nIndex; m < pE->nTileBatches; m += pE->nTileThreads)
+  {
+    tile_batch(pE, m);
+  }
+
+  return NULL;
+}
+#endif // USE_THREAD
+
+// runs the wavefront engine for as many whole batches as it's worth and adds the
+// sweeps it did to 'nSweeps'.  Returns the number of sweeps it did
+
+int32_t tile_run(PI_ENGINE *pE)
+{
+int32_t m, nDone;
+#ifdef USE_THREAD
+int i1, nStarted;
+#endif // USE_THREAD
+
+
+  pE->nTileBlocks = (pE->aSeries[0].nLen - 2) / pE->nTileBlock + 1;
+
+  // stop once the series 0 sweeps get shorter than a few blocks, there's nothing left to pipeline
+  nDone = (int32_t)((pE->n - 4.0 * pE->nTileBlock * pE->aSeries[0].dLog) / pE->nChunk);
+  pE->nTileBatches = nDone > 0 ? nDone / pE->nTileDepth : 0;
+
+  if(!pE->nTileBatches)
+  {
+    return 0;
+  }
+
+#ifdef USE_THREAD
+  nStarted = 0;
+
+  if(pE->nTileThreads > 1)
+  {
+    pE->pTileWorkers = (TILE_WORKER *)calloc(pE->nTileThreads, sizeof(TILE_WORKER));
+
+    if(!pE->pTileWorkers)
+    {
+      pE->nTileThreads = 1; // run anyway
+    }
+  }
+
+  if(pE->nTileThreads > 1)
+  {
+    for(i1 = 0; i1 < pE->nTileThreads; i1++)
+    {
+      pE->pTileWorkers[i1].nIndex = i1;
+      pE->pTileWorkers[i1].llDone = -1;
+      pE->pTileWorkers[i1].pE = pE;
+      gate_init(&(pE->pTileWorkers[i1].gate));
+    }
+
+    // worker 0 is this thread
+    for(i1 = 1; i1 < pE->nTileThreads; i1++)
+    {
+      if(pthread_create(&(pE->pTileWorkers[i1].idThread), NULL, tile_thread_proc, pE->pTileWorkers + i1))
+      {
+        break;
+      }
+
+      nStarted++;
+    }
+
+    if(nStarted < pE->nTileThreads - 1) // couldn't start them all
+    {
+      fprintf(stderr, "NOTE:  could only start %d of %d threads\n", nStarted + 1, pE->nTileThreads);
+
+      // the ones that DID start are waiting on batches nobody will do; let them finish
+      // 'their' batches by having this thread run the missing workers' batches as well
+      for(m = 0; m < pE->nTileBatches; m++)
+      {
+        i1 = m % pE->nTileThreads;
+
+        if(i1 == 0 || i1 > nStarted)
+        {
+          tile_batch(pE, m);
+        }
+      }
+    }
+    else
+    {
+      tile_thread_proc(pE->pTileWorkers);
+    }
+
+    for(i1 = 1; i1 <= nStarted; i1++)
+    {
+      pthread_join(pE->pTileWorkers[i1].idThread, NULL);
+    }
+
+    for(i1 = 0; i1 < pE->nTileThreads; i1++)
+    {
+      gate_destroy(&(pE->pTileWorkers[i1].gate));
+    }
+
+    free(pE->pTileWorkers);
+    pE->pTileWorkers = NULL;
+  }
+  else
+#endif // USE_THREAD
+  {
+    for(m = 0; m < pE->nTileBatches; m++)
+    {
+      tile_batch(pE, m);
+    }
+  }
+
+  nDone = pE->nTileBatches * pE->nTileDepth;
+  pE->nSweeps += nDone;
+
+  return nDone;
+}
+
+// MACHIN-LIKE FORMULAS ('-f') - pi as a sum of c * atan(1/x) terms.  Machin's formula is
+// the default.  Stormer's and Takano's formulas have 4 terms each, with bigger x, so the
+// total work is about the same but it's spread over 4 series, which is 4 cores.  Any
+// other formula can be given as a list of 'c:x' pairs.  Each term is its own spigot array
+// and the digits are combined in 'shift1' and 'xprint' just like Machin's two always were.
+
+typedef struct _FORMULA_
+{
+  const char *pName;
+  const char *pTerms; // c:x pairs
+} FORMULA;
+
+FORMULA aFormulas[] =
+{
+  { "machin",  "16:5,-4:239" },
+  { "stormer", "176:57,28:239,-48:682,96:12943" },
+  { "takano",  "48:49,128:57,-20:239,48:110443" },
+  { NULL, NULL }
+};
+
+// sets up 'aSeries' and 'nSeries' from a formula name or a 'c:x,c:x,...' list, sorted by
+// 'x'.  Returns zero (after saying why) if it can't be used
+
+int set_formula(PI_ENGINE *pE, const char *pFormula)
+{
+FORMULA *pF;
+ARCTAN_SERIES sTmp;
+const char *p1;
+char *endp;
+double dSum;
+int s, s2;
+
+  for(pF = aFormulas; pF->pName; pF++)
+  {
+    if(!strcmp(pF->pName, pFormula))
+    {
+      pFormula = pF->pTerms;
+      break;
+    }
+  }
+
+  memset(pE->aSeries, 0, sizeof(pE->aSeries));
+  pE->nSeries = 0;
+
+  for(p1 = pFormula; *p1; p1 = *endp ? endp + 1 : endp)
+  {
+    if(pE->nSeries >= MAX_SERIES)
+    {
+      fprintf(stderr, "\nA formula can't have more than %d terms\n", MAX_SERIES);
+      return 0;
+    }
+
+    pE->aSeries[pE->nSeries].c = strtol(p1, &endp, 10);
+
+    if(endp != p1 && *endp == ':')
+    {
+      p1 = endp + 1;
+      pE->aSeries[pE->nSeries].x = strtol(p1, &endp, 10);
+    }
+
+    if(endp == p1 || (*endp && *endp != ',') || !pE->aSeries[pE->nSeries].c)
+    {
+      fprintf(stderr, "\n'%s' is not a formula name or a list of c:x pairs\n", pFormula);
+      return 0;
+    }
+
+    if(pE->aSeries[pE->nSeries].x < 2 || pE->aSeries[pE->nSeries].x > MAX_SERIES_X)
+    {
+      fprintf(stderr, "\nx must be between 2 and %ld in atan(1/x)\n", MAX_SERIES_X);
+      return 0;
+    }
+
+    pE->nSeries++;
+  }
+
+  // it had better be pi, or the digits are just noise
+  for(dSum = 0.0, s = 0; s < pE->nSeries; s++)
+  {
+    dSum += (double)pE->aSeries[s].c * atan(1.0 / (double)pE->aSeries[s].x);
+  }
+
+  if(!pE->nSeries || fabs(dSum - 4.0 * atan(1.0)) > 1e-9)
+  {
+    fprintf(stderr, "\nformula '%s' adds up to %.12f, not pi\n", pFormula, dSum);
+    return 0;
+  }
+
+  for(s = 1; s < pE->nSeries; s++) // sort by 'x', there are only a few
+  {
+    sTmp = pE->aSeries[s];
+
+    for(s2 = s; s2 > 0 && pE->aSeries[s2 - 1].x > sTmp.x; s2--)
+    {
+      pE->aSeries[s2] = pE->aSeries[s2 - 1];
+    }
+
+    pE->aSeries[s2] = sTmp;
+  }
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    pE->aSeries[s].kk = pE->aSeries[s].x * pE->aSeries[s].x;
+    pE->aSeries[s].dLog = log10((double)pE->aSeries[s].kk);
+  }
+
+  return 1;
+}
+
+
+// CHUDNOVSKY ENGINE ('-c') - the spigot does O(n^2) work, so a few million digits takes
+// hours no matter how many cores there are.  This is the other way to do it:
+//
+//   pi = 426880 * sqrt(10005) * Q(0,N) / T(0,N)
+//
+// where Q and T come from binary splitting the Chudnovsky series (about 14.18 digits per
+// term), then one square root and one division, both done with Newton's method.  All of
+// that is O(M(n) log(n)) or so, where M(n) is the cost of an n-digit multiply, so the
+// multiply is everything:  schoolbook for small numbers, Karatsuba and Toom-3 in the middle,
+// and a 3-prime NTT (number theoretic transform) for the big ones.
+//
+// The numbers are kept in base 10^9, not binary, so the radix conversion at the end is just
+// splitting each limb into its 9 digits.  Those go through 'yprint', the same as the spigot's
+// digits, so the output matches it byte for byte.
+
+#define BN_BASE 1000000000UL /* one limb, 9 decimal digits */
+#define BN_DIGITS 9
+#define KARATSUBA_MIN 40     /* limbs in the smaller operand, below this it's schoolbook */
+#define TOOM3_MIN 160        /* and below this it's Karatsuba */
+#define NTT_MIN 2400         /* total limbs in both operands, at or above this it's the NTT */
+#define NTT_MAX_LOG 23       /* the longest transform is 2^23, see 'aNttPrimes' */
+#define NTT_THREAD_MIN 32768 /* total limbs at which the three primes get a thread each */
+#define CHUD_DIGITS_PER_TERM 14.181647462725477 /* log10(640320^3 / 1728) */
+
+typedef struct _BIGNUM_
+{
+  uint32_t *pd;    // limbs, least significant first, each < BN_BASE
+  int32_t nLen;    // limbs in use, no leading zeros, 0 for zero
+  int32_t nAlloc;  // limbs allocated, 0 for a 'view' of somebody else's limbs
+  int nSign;       // 1 or -1, zero is always 1
+} BIGNUM;
+
+// LIMB VECTORS - the 'lv_' functions work on bare limb arrays, 'a' with 'na' limbs and so on
+
+int32_t lv_trim(const uint32_t *a, int32_t na)
+{
+  while(na > 0 && !a[na - 1])
+  {
+    na--;
+  }
+
+  return na;
+}
+
+int lv_cmp(const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+  na = lv_trim(a, na);
+  nb = lv_trim(b, nb);
+
+  if(na != nb)
+  {
+    return na < nb ? -1 : 1;
+  }
+
+  while(na-- > 0)
+  {
+    if(a[na] != b[na])
+    {
+      return a[na] < b[na] ? -1 : 1;
+    }
+  }
+
+  return 0;
+}
+
+// r = a + b, 'r' has room for the longer one plus 1 and may be 'a' or 'b'.  Returns its length
+
+int32_t lv_add(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+const uint32_t *pt;
+uint32_t c = 0, t;
+int32_t i;
+
+  if(na < nb)
+  {
+    pt = a; a = b; b = pt;
+    i = na; na = nb; nb = i;
+  }
+
+  for(i = 0; i < nb; i++)
+  {
+    t = a[i] + b[i] + c;
+    c = t >= BN_BASE;
+    r[i] = c ? t - BN_BASE : t;
+  }
+
+  for(; i < na; i++)
+  {
+    t = a[i] + c;
+    c = t >= BN_BASE;
+    r[i] = c ? t - BN_BASE : t;
+  }
+
+  if(c)
+  {
+    r[i++] = 1;
+  }
+
+  return i;
+}
+
+// r = a - b where a >= b (and na >= nb), 'r' may be 'a'.  Returns the trimmed length
+
+int32_t lv_sub(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+uint32_t c = 0, s;
+int32_t i;
+
+  for(i = 0; i < na; i++)
+  {
+    s = (i < nb ? b[i] : 0) + c;
+    c = a[i] < s;
+    r[i] = c ? a[i] + BN_BASE - s : a[i] - s;
+  }
+
+  return lv_trim(r, na);
+}
+
+// r += a, where 'r' has 'nr' limbs and the sum fits in them
+
+void lv_addto(uint32_t *r, int32_t nr, const uint32_t *a, int32_t na)
+{
+uint32_t c = 0, t;
+int32_t i;
+
+  for(i = 0; i < na; i++)
+  {
+    t = r[i] + a[i] + c;
+    c = t >= BN_BASE;
+    r[i] = c ? t - BN_BASE : t;
+  }
+
+  for(; c && i < nr; i++)
+  {
+    t = r[i] + 1;
+    c = t >= BN_BASE;
+    r[i] = c ? 0 : t;
+  }
+}
+
+// r -= a, where r >= a
+
+void lv_subfrom(uint32_t *r, int32_t nr, const uint32_t *a, int32_t na)
+{
+uint32_t c = 0, s;
+int32_t i;
+
+  for(i = 0; i < na; i++)
+  {
+    s = a[i] + c;
+    c = r[i] < s;
+    r[i] = c ? r[i] + BN_BASE - s : r[i] - s;
+  }
+
+  for(; c && i < nr; i++)
+  {
+    c = !r[i];
+    r[i] = c ? BN_BASE - 1 : r[i] - 1;
+  }
+}
+
+// r = a * m, 'r' may be 'a' and has room for 2 more limbs.  Returns its length
+
+int32_t lv_mul_small(uint32_t *r, const uint32_t *a, int32_t na, uint32_t m)
+{
+uint64_t t, c = 0;
+int32_t i;
+
+  for(i = 0; i < na; i++)
+  {
+    t = (uint64_t)a[i] * m + c;
+    r[i] = (uint32_t)(t % BN_BASE);
+    c = t / BN_BASE;
+  }
+
+  while(c)
+  {
+    r[i++] = (uint32_t)(c % BN_BASE);
+    c /= BN_BASE;
+  }
+
+  return lv_trim(r, i);
+}
+
+void lv_mul(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb);
+
+void lv_mul_school(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+uint64_t t, c;
+uint32_t ai;
+int32_t i, j;
+
+  memset(r, 0, (na + nb) * sizeof(uint32_t));
+
+  for(i = 0; i < na; i++)
+  {
+    if(!(ai = a[i]))
+    {
+      continue;
+    }
+
+    for(c = 0, j = 0; j < nb; j++)
+    {
+      t = (uint64_t)ai * b[j] + r[i + j] + c;
+      r[i + j] = (uint32_t)(t % BN_BASE);
+      c = t / BN_BASE;
+    }
+
+    r[i + nb] = (uint32_t)c;
+  }
+}
+
+uint32_t *lv_alloc(int32_t n)
+{
+uint32_t *p = (uint32_t *)Fcalloc((Size_T)(n > 0 ? n : 1), (Size_T)sizeof(uint32_t));
+
+  if(!p)
+  {
+    memerr(MAX_SERIES + 2);
+  }
+
+  return p;
+}
+
+// 'a' is a lot longer than 'b', so it's cut into pieces the size of 'b'
+
+void lv_mul_chunked(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+uint32_t *pt = lv_alloc(2 * nb);
+int32_t i, nc;
+
+  memset(r, 0, (na + nb) * sizeof(uint32_t));
+
+  for(i = 0; i < na; i += nb)
+  {
+    nc = na - i < nb ? na - i : nb;
+
+    lv_mul(pt, a + i, nc, b, nb);
+    lv_addto(r + i, na + nb - i, pt, nc + nb);
+  }
+
+  Ffree(pt);
+}
+
+// Karatsuba, na >= nb.  With a = a1 B^h + a0 and b = b1 B^h + b0 it's three multiplies
+// instead of four:  a0 b0, a1 b1, and (a0 + a1)(b0 + b1) minus the other two
+
+void lv_mul_karatsuba(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+uint32_t *pt, *sa, *sb, *z1;
+int32_t h, nsa, nsb, nz1;
+
+  h = (na + 1) / 2;
+
+  if(nb <= h)
+  {
+    lv_mul_chunked(r, a, na, b, nb);
+    return;
+  }
+
+  lv_mul(r, a, h, b, h);                              // z0, low 2h limbs
+  lv_mul(r + 2 * h, a + h, na - h, b + h, nb - h);    // z2, the rest
+
+  pt = lv_alloc(4 * h + 4);
+  sa = pt;
+  sb = pt + h + 1;
+  z1 = pt + 2 * h + 2;
+
+  nsa = lv_add(sa, a, h, a + h, na - h);
+  nsb = lv_add(sb, b, h, b + h, nb - h);
+  lv_mul(z1, sa, nsa, sb, nsb);
+  nz1 = nsa + nsb;
+
+  lv_subfrom(z1, nz1, r, 2 * h);
+  lv_subfrom(z1, nz1, r + 2 * h, na + nb - 2 * h);
+  lv_addto(r + h, na + nb - h, z1, lv_trim(z1, nz1));
+
+  Ffree(pt);
+}
+
+// BIGNUMS - signed, allocated as they grow.  Results go to a temporary first, so the
+// result can always be one of the operands
+
+void bn_init(BIGNUM *p)
+{
+  p->pd = NULL;
+  p->nLen = p->nAlloc = 0;
+  p->nSign = 1;
+}
+
+void bn_free(BIGNUM *p)
+{
+  if(p->nAlloc)
+  {
+    Ffree(p->pd);
+  }
+
+  bn_init(p);
+}
+
+// a read-only view of 'n' limbs of somebody else's number
+
+void bn_view(BIGNUM *p, const uint32_t *pd, int32_t n)
+{
+  p->pd = (uint32_t *)pd;
+  p->nLen = lv_trim(pd, n > 0 ? n : 0);
+  p->nAlloc = 0;
+  p->nSign = 1;
+}
+
+void bn_reserve(BIGNUM *p, int32_t n)
+{
+uint32_t *pd;
+
+  if(n <= p->nAlloc)
+  {
+    return;
+  }
+
+  n += n / 8 + 4;
+  pd = lv_alloc(n);
+
+  if(p->nLen)
+  {
+    memcpy(pd, p->pd, p->nLen * sizeof(uint32_t));
+  }
+
+  if(p->nAlloc)
+  {
+    Ffree(p->pd);
+  }
+
+  p->pd = pd;
+  p->nAlloc = n;
+}
+
+// swaps in the temporary 't' as the new value of 'p', and frees the old one
+
+void bn_take(BIGNUM *p, BIGNUM *t)
+{
+  if(!t->nLen)
+  {
+    t->nSign = 1;
+  }
+
+  bn_free(p);
+  *p = *t;
+  bn_init(t);
+}
+
+void bn_set_u64(BIGNUM *p, uint64_t v)
+{
+BIGNUM t;
+
+  bn_init(&t);
+  bn_reserve(&t, 3);
+
+  while(v)
+  {
+    t.pd[t.nLen++] = (uint32_t)(v % BN_BASE);
+    v /= BN_BASE;
+  }
+
+  bn_take(p, &t);
+}
+
+void bn_copy(BIGNUM *p, const BIGNUM *a)
+{
+BIGNUM t;
+
+  bn_init(&t);
+  bn_reserve(&t, a->nLen + 1);
+  memcpy(t.pd, a->pd, a->nLen * sizeof(uint32_t));
+  t.nLen = a->nLen;
+  t.nSign = a->nSign;
+
+  bn_take(p, &t);
+}
+
+// p = BASE^k
+
+void bn_set_pow(BIGNUM *p, int32_t k)
+{
+BIGNUM t;
+
+  bn_init(&t);
+  bn_reserve(&t, k + 1);
+  memset(t.pd, 0, (k + 1) * sizeof(uint32_t));
+  t.pd[k] = 1;
+  t.nLen = k + 1;
+
+  bn_take(p, &t);
+}
+
+// p = a + b * nSignB, so 'bn_add' and 'bn_sub' are the same thing
+
+void bn_add_signed(BIGNUM *p, const BIGNUM *a, const BIGNUM *b, int nSignB)
+{
+BIGNUM t;
+
+  nSignB *= b->nSign;
+
+  bn_init(&t);
+  bn_reserve(&t, (a->nLen > b->nLen ? a->nLen : b->nLen) + 1);
+
+  if(a->nSign == nSignB)
+  {
+    t.nLen = lv_add(t.pd, a->pd, a->nLen, b->pd, b->nLen);
+    t.nSign = nSignB;
+  }
+  else if(lv_cmp(a->pd, a->nLen, b->pd, b->nLen) >= 0)
+  {
+    t.nLen = lv_sub(t.pd, a->pd, a->nLen, b->pd, b->nLen);
+    t.nSign = a->nSign;
+  }
+  else
+  {
+    t.nLen = lv_sub(t.pd, b->pd, b->nLen, a->pd, a->nLen);
+    t.nSign = nSignB;
+  }
+
+  bn_take(p, &t);
+}
+
+void bn_add(BIGNUM *p, const BIGNUM *a, const BIGNUM *b)
+{
+  bn_add_signed(p, a, b, 1);
+}
+
+void bn_sub(BIGNUM *p, const BIGNUM *a, const BIGNUM *b)
+{
+  bn_add_signed(p, a, b, -1);
+}
+
+void bn_mul(BIGNUM *p, const BIGNUM *a, const BIGNUM *b)
+{
+BIGNUM t;
+
+  bn_init(&t);
+
+  if(a->nLen && b->nLen)
+  {
+    bn_reserve(&t, a->nLen + b->nLen);
+    lv_mul(t.pd, a->pd, a->nLen, b->pd, b->nLen);
+    t.nLen = lv_trim(t.pd, a->nLen + b->nLen);
+    t.nSign = a->nSign * b->nSign;
+  }
+
+  bn_take(p, &t);
+}
+
+void bn_mul_small(BIGNUM *p, const BIGNUM *a, uint32_t m)
+{
+BIGNUM t;
+
+  bn_init(&t);
+  bn_reserve(&t, a->nLen + 2);
+  t.nLen = lv_mul_small(t.pd, a->pd, a->nLen, m);
+  t.nSign = a->nSign;
+
+  bn_take(p, &t);
+}
+
+// p = a / m, rounded toward zero
+
+void bn_div_small(BIGNUM *p, const BIGNUM *a, uint32_t m)
+{
+BIGNUM t;
+uint64_t cur, rem = 0;
+int32_t i;
+
+  bn_init(&t);
+  bn_reserve(&t, a->nLen + 1);
+
+  for(i = a->nLen - 1; i >= 0; i--)
+  {
+    cur = rem * BN_BASE + a->pd[i];
+    t.pd[i] = (uint32_t)(cur / m);
+    rem = cur % m;
+  }
+
+  t.nLen = lv_trim(t.pd, a->nLen);
+  t.nSign = a->nSign;
+
+  bn_take(p, &t);
+}
+
+// p = a * BASE^k
+
+void bn_shl(BIGNUM *p, const BIGNUM *a, int32_t k)
+{
+BIGNUM t;
+
+  bn_init(&t);
+
+  if(a->nLen)
+  {
+    bn_reserve(&t, a->nLen + k);
+    memset(t.pd, 0, k * sizeof(uint32_t));
+    memcpy(t.pd + k, a->pd, a->nLen * sizeof(uint32_t));
+    t.nLen = a->nLen + k;
+    t.nSign = a->nSign;
+  }
+
+  bn_take(p, &t);
+}
+
+// p = a / BASE^k, rounded toward zero
+
+void bn_shr(BIGNUM *p, const BIGNUM *a, int32_t k)
+{
+BIGNUM t;
+
+  bn_init(&t);
+
+  if(a->nLen > k)
+  {
+    bn_reserve(&t, a->nLen - k);
+    memcpy(t.pd, a->pd + k, (a->nLen - k) * sizeof(uint32_t));
+    t.nLen = a->nLen - k;
+    t.nSign = a->nSign;
+  }
+
+  bn_take(p, &t);
+}
+
+// Toom-3, na >= nb.  Both are cut in 3 pieces and treated as polynomials in B^k, which are
+// evaluated at 0, 1, -1, -2 and infinity, multiplied (5 multiplies instead of 9), and
+// interpolated back (Bodrato's sequence).  The evaluations can go negative, so this part
+// uses signed bignums
+
+void lv_mul_toom3(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+BIGNUM a0, a1, a2, b0, b1, b2;
+BIGNUM p0, p1, pm1, pm2, q0, q1, qm1, qm2;
+BIGNUM r0, r1, rm1, rm2, rinf, r2, r3;
+BIGNUM *pc[5];
+int32_t k, i;
+
+  k = (na + 2) / 3;
+
+  if(nb <= 2 * k)
+  {
+    lv_mul_karatsuba(r, a, na, b, nb);
+    return;
+  }
+
+  bn_view(&a0, a, k);
+  bn_view(&a1, a + k, k);
+  bn_view(&a2, a + 2 * k, na - 2 * k);
+  bn_view(&b0, b, k);
+  bn_view(&b1, b + k, k);
+  bn_view(&b2, b + 2 * k, nb - 2 * k);
+
+  bn_init(&p0); bn_init(&p1); bn_init(&pm1); bn_init(&pm2);
+  bn_init(&q0); bn_init(&q1); bn_init(&qm1); bn_init(&qm2);
+  bn_init(&r0); bn_init(&r1); bn_init(&rm1); bn_init(&rm2);
+  bn_init(&rinf); bn_init(&r2); bn_init(&r3);
+
+  bn_add(&p0, &a0, &a2);     // evaluation
+  bn_add(&p1, &p0, &a1);     // p(1)
+  bn_sub(&pm1, &p0, &a1);    // p(-1)
+  bn_add(&pm2, &pm1, &a2);
+  bn_mul_small(&pm2, &pm2, 2);
+  bn_sub(&pm2, &pm2, &a0);   // p(-2)
+
+  bn_add(&q0, &b0, &b2);
+  bn_add(&q1, &q0, &b1);
+  bn_sub(&qm1, &q0, &b1);
+  bn_add(&qm2, &qm1, &b2);
+  bn_mul_small(&qm2, &qm2, 2);
+  bn_sub(&qm2, &qm2, &b0);
+
+  bn_mul(&r0, &a0, &b0);     // pointwise
+  bn_mul(&r1, &p1, &q1);
+  bn_mul(&rm1, &pm1, &qm1);
+  bn_mul(&rm2, &pm2, &qm2);
+  bn_mul(&rinf, &a2, &b2);
+
+  bn_sub(&r3, &rm2, &r1);    // interpolation
+  bn_div_small(&r3, &r3, 3);
+  bn_sub(&r1, &r1, &rm1);
+  bn_div_small(&r1, &r1, 2);
+  bn_sub(&r2, &rm1, &r0);
+  bn_sub(&r3, &r2, &r3);
+  bn_div_small(&r3, &r3, 2);
+  bn_add(&r3, &r3, &rinf);
+  bn_add(&r3, &r3, &rinf);
+  bn_add(&r2, &r2, &r1);
+  bn_sub(&r2, &r2, &rinf);
+  bn_sub(&r1, &r1, &r3);
+
+  // every coefficient of the product is non-negative
+  pc[0] = &r0; pc[1] = &r1; pc[2] = &r2; pc[3] = &r3; pc[4] = &rinf;
+
+  memset(r, 0, (na + nb) * sizeof(uint32_t));
+
+  for(i = 0; i < 5; i++)
+  {
+    lv_addto(r + i * k, na + nb - i * k, pc[i]->pd, pc[i]->nLen);
+  }
+
+  bn_free(&p0); bn_free(&p1); bn_free(&pm1); bn_free(&pm2);
+  bn_free(&q0); bn_free(&q1); bn_free(&qm1); bn_free(&qm2);
+  bn_free(&r0); bn_free(&r1); bn_free(&rm1); bn_free(&rm2);
+  bn_free(&rinf); bn_free(&r2); bn_free(&r3);
+}
+
+// NTT - the product's limbs are a convolution, which is done modulo 3 primes that have big
+// power-of-2 roots of unity, and put back together with the Chinese remainder theorem.
+// Every term of the convolution is under 2^23 * 10^18, and the 3 primes multiply to about
+// 7.9 * 10^25, so that's exact.  The arithmetic is Montgomery, so there are no divides
+
+typedef struct _NTT_PRIME_
+{
+  uint32_t p;     // c * 2^k + 1
+  uint32_t g;     // primitive root
+  uint32_t pinv;  // -1/p mod 2^32
+  uint32_t r2;    // 2^64 mod p
+} NTT_PRIME;
+
+NTT_PRIME aNttPrimes[3] =
+{
+  { 998244353u, 3, 0, 0 }, // 119 * 2^23 + 1
+  { 167772161u, 3, 0, 0 }, // 5 * 2^25 + 1
+  { 469762049u, 3, 0, 0 }  // 7 * 2^26 + 1
+};
+
+uint64_t ullInv12, ullInv123; // 1/p1 mod p2, 1/(p1 p2) mod p3, for the CRT
+uint64_t ullP12Hi, ullP12Lo;  // p1 p2 in limbs
+
+__inline uint32_t mont_mul(uint32_t a, uint32_t b, const NTT_PRIME *pP)
+{
+uint64_t t = (uint64_t)a * b;
+uint32_t m = (uint32_t)t * pP->pinv;
+uint32_t u = (uint32_t)((t + (uint64_t)m * pP->p) >> 32);
+
+  return u >= pP->p ? u - pP->p : u;
+}
+
+// 'a' to the 'e' power, where 'a' is in Montgomery form and so is the result
+
+uint32_t mont_pow(uint32_t a, uint64_t e, const NTT_PRIME *pP)
+{
+uint32_t r = mont_mul(1, pP->r2, pP);
+
+  while(e)
+  {
+    if(e & 1)
+    {
+      r = mont_mul(r, a, pP);
+    }
+
+    a = mont_mul(a, a, pP);
+    e >>= 1;
+  }
+
+  return r;
+}
+
+uint64_t pow_mod(uint64_t a, uint64_t e, uint64_t m)
+{
+uint64_t r = 1;
+
+  for(a %= m; e; e >>= 1)
+  {
+    if(e & 1)
+    {
+      r = r * a % m;
+    }
+
+    a = a * a % m;
+  }
+
+  return r;
+}
+
+void ntt_setup(void)
+{
+NTT_PRIME *pP;
+uint32_t inv;
+int i1, i2;
+
+  for(i1 = 0; i1 < 3; i1++)
+  {
+    pP = aNttPrimes + i1;
+
+    for(inv = pP->p, i2 = 0; i2 < 5; i2++)
+    {
+      inv *= 2 - pP->p * inv;
+    }
+
+    pP->pinv = (uint32_t)0 - inv;
+    pP->r2 = (uint32_t)(((uint64_t)-1 % pP->p + 1) % pP->p);
+  }
+
+  ullInv12 = pow_mod(aNttPrimes[0].p, aNttPrimes[1].p - 2, aNttPrimes[1].p);
+  ullInv123 = pow_mod((uint64_t)aNttPrimes[0].p * aNttPrimes[1].p % aNttPrimes[2].p,
+                      aNttPrimes[2].p - 2, aNttPrimes[2].p);
+  ullP12Hi = (uint64_t)aNttPrimes[0].p * aNttPrimes[1].p / BN_BASE;
+  ullP12Lo = (uint64_t)aNttPrimes[0].p * aNttPrimes[1].p % BN_BASE;
+}
+
+// the constants are the same every time, but an engine on another thread may be using them
+
+#ifdef USE_THREAD
+pthread_once_t onceNtt = PTHREAD_ONCE_INIT;
+#endif // USE_THREAD
+
+void ntt_init(void)
+{
+#ifdef USE_THREAD
+  pthread_once(&onceNtt, ntt_setup);
+#else  // USE_THREAD
+  ntt_setup();
+#endif // USE_THREAD
+}
+
+// in-place transform of 'f' ('nLog' = log2 of its length), values in normal form.  The
+// inverse leaves out the 1/N, the caller does that
+
+void ntt(uint32_t *f, int nLog, int bInverse, const NTT_PRIME *pP, uint32_t *pTw)
+{
+int32_t nN = (int32_t)1 << nLog;
+int32_t i, j, k, len, half;
+uint32_t w, u, v, p = pP->p;
+
+  for(i = 1, j = 0; i < nN; i++) // bit reversal
+  {
+    for(k = nN >> 1; j & k; k >>= 1)
+    {
+      j ^= k;
+    }
+
+    j |= k;
+
+    if(i < j)
+    {
+      u = f[i]; f[i] = f[j]; f[j] = u;
+    }
+  }
+
+  for(len = 2; len <= nN; len <<= 1)
+  {
+    half = len >> 1;
+
+    // the twiddles for this stage, in Montgomery form
+    w = mont_pow(mont_mul(pP->g, pP->r2, pP), (p - 1) / len, pP);
+    if(bInverse)
+    {
+      w = mont_pow(w, p - 2, pP);
+    }
+
+    pTw[0] = mont_mul(1, pP->r2, pP);
+    for(j = 1; j < half; j++)
+    {
+      pTw[j] = mont_mul(pTw[j - 1], w, pP);
+    }
+
+    for(i = 0; i < nN; i += len)
+    {
+      for(j = 0; j < half; j++)
+      {
+        u = f[i + j];
+        v = mont_mul(f[i + j + half], pTw[j], pP);
+
+        f[i + j] = u + v >= p ? u + v - p : u + v;
+        f[i + j + half] = u >= v ? u - v : u + p - v;
+      }
+    }
+  }
+}
+
+typedef struct _NTT_JOB_
+{
+  const uint32_t *a, *b;
+  int32_t na, nb;
+  int nLog;
+  int nPrime;
+  uint32_t *pOut; // the convolution mod the prime, 2^nLog values
+} NTT_JOB;
+
+// one prime's worth of the convolution
+
+void *ntt_job_proc(void *pArg)
+{
+NTT_JOB *pJ = (NTT_JOB *)pArg;
+const NTT_PRIME *pP = aNttPrimes + pJ->nPrime;
+int32_t nN = (int32_t)1 << pJ->nLog, i;
+uint32_t *fa = pJ->pOut, *fb = NULL, *pTw, scale;
+int bSquare = pJ->a == pJ->b && pJ->na == pJ->nb;
+
+  pTw = lv_alloc(nN / 2 + 1);
+
+  memset(fa, 0, nN * sizeof(uint32_t));
+  for(i = 0; i < pJ->na; i++)
+  {
+    fa[i] = pJ->a[i] % pP->p;
+  }
+  ntt(fa, pJ->nLog, 0, pP, pTw);
+
+  if(!bSquare)
+  {
+    fb = lv_alloc(nN);
+    for(i = 0; i < pJ->nb; i++)
+    {
+      fb[i] = pJ->b[i] % pP->p;
+    }
+    ntt(fb, pJ->nLog, 0, pP, pTw);
+  }
+
+  // (a * b / R) * R^2 / R = a * b
+  for(i = 0; i < nN; i++)
+  {
+    fa[i] = mont_mul(mont_mul(fa[i], bSquare ? fa[i] : fb[i], pP), pP->r2, pP);
+  }
+
+  ntt(fa, pJ->nLog, 1, pP, pTw);
+
+  scale = mont_mul((uint32_t)pow_mod(nN, pP->p - 2, pP->p), pP->r2, pP); // 1/N
+  for(i = 0; i < nN; i++)
+  {
+    fa[i] = mont_mul(fa[i], scale, pP);
+  }
+
+  if(fb)
+  {
+    Ffree(fb);
+  }
+  Ffree(pTw);
+
+  return NULL;
+}
+
+void lv_mul_ntt(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+NTT_JOB aJobs[3];
+uint64_t *pAcc, x12, k2, k3, t, lo, hi;
+int32_t nN, i, nr = na + nb;
+int nLog, i1;
+#ifdef USE_THREAD
+pthread_t aThreads[3];
+int bThread[3];
+#endif // USE_THREAD
+
+  for(nLog = 0, nN = 1; nN < nr - 1; nLog++)
+  {
+    nN <<= 1;
+  }
+
+  for(i1 = 0; i1 < 3; i1++)
+  {
+    aJobs[i1].a = a;
+    aJobs[i1].b = b;
+    aJobs[i1].na = na;
+    aJobs[i1].nb = nb;
+    aJobs[i1].nLog = nLog;
+    aJobs[i1].nPrime = i1;
+    aJobs[i1].pOut = lv_alloc(nN);
+  }
+
+#ifdef USE_THREAD
+  for(i1 = 1; i1 < 3; i1++)
+  {
+    bThread[i1] = pRunEngine && pRunEngine->nChudThreads > 1 && nr >= NTT_THREAD_MIN &&
+                  run_spawn(aThreads + i1, ntt_job_proc, aJobs + i1);
+  }
+
+  ntt_job_proc(aJobs);
+
+  for(i1 = 1; i1 < 3; i1++)
+  {
+    if(bThread[i1])
+    {
+      run_join(aThreads[i1]);
+    }
+    else
+    {
+      ntt_job_proc(aJobs + i1);
+    }
+  }
+#else  // USE_THREAD
+  for(i1 = 0; i1 < 3; i1++)
+  {
+    ntt_job_proc(aJobs + i1);
+  }
+#endif // USE_THREAD
+
+  // CRT (Garner), each value is x12 + p1 p2 k3, which goes into 3 limbs
+  pAcc = (uint64_t *)Fcalloc((Size_T)(nr + 2), (Size_T)sizeof(uint64_t));
+  if(!pAcc)
+  {
+    memerr(MAX_SERIES + 2);
+  }
+
+  for(i = 0; i < nr - 1; i++)
+  {
+    k2 = (aJobs[1].pOut[i] + aNttPrimes[1].p - aJobs[0].pOut[i] % aNttPrimes[1].p) % aNttPrimes[1].p;
+    k2 = k2 * ullInv12 % aNttPrimes[1].p;
+    x12 = aJobs[0].pOut[i] + (uint64_t)aNttPrimes[0].p * k2;
+
+    k3 = (aJobs[2].pOut[i] + aNttPrimes[2].p - x12 % aNttPrimes[2].p) % aNttPrimes[2].p;
+    k3 = k3 * ullInv123 % aNttPrimes[2].p;
+
+    lo = k3 * ullP12Lo;
+    hi = k3 * ullP12Hi;
+
+    pAcc[i] += x12 % BN_BASE + lo % BN_BASE;
+    pAcc[i + 1] += x12 / BN_BASE + lo / BN_BASE + hi % BN_BASE;
+    pAcc[i + 2] += hi / BN_BASE;
+  }
+
+  for(t = 0, i = 0; i < nr; i++)
+  {
+    t += pAcc[i];
+    r[i] = (uint32_t)(t % BN_BASE);
+    t /= BN_BASE;
+  }
+
+  Ffree(pAcc);
+  for(i1 = 0; i1 < 3; i1++)
+  {
+    Ffree(aJobs[i1].pOut);
+  }
+}
+
+// r = a * b, 'r' has na + nb limbs and isn't 'a' or 'b'.  Picks the method by size
+
+void lv_mul(uint32_t *r, const uint32_t *a, int32_t na, const uint32_t *b, int32_t nb)
+{
+const uint32_t *pt;
+int32_t n1;
+
+  if(na < nb)
+  {
+    pt = a; a = b; b = pt;
+    n1 = na; na = nb; nb = n1;
+  }
+
+  if(!nb)
+  {
+    memset(r, 0, na * sizeof(uint32_t));
+  }
+  else if(nb < KARATSUBA_MIN)
+  {
+    lv_mul_school(r, a, na, b, nb);
+  }
+  else if(na + nb >= NTT_MIN && na + nb <= ((int32_t)1 << NTT_MAX_LOG))
+  {
+    lv_mul_ntt(r, a, na, b, nb);
+  }
+  else if(na >= 2 * nb)
+  {
+    lv_mul_chunked(r, a, na, b, nb);
+  }
+  else if(nb >= TOOM3_MIN)
+  {
+    lv_mul_toom3(r, a, na, b, nb);
+  }
+  else
+  {
+    lv_mul_karatsuba(r, a, na, b, nb);
+  }
+}
+
+// NEWTON - 'bn_recip' gives BASE^(m + p) / d for an 'm' limb 'd', good to a few units,
+// doubling the precision each step:  r' = r + r (BASE^(m + p) - d r) / BASE^(m + p).
+// 'bn_invsqrt' is the same idea for BASE^p / sqrt(c):  y' = y + y (1 - c y^2) / 2.  Only
+// the top p + 2 limbs of 'd' matter, so the early steps are all small
+
+void bn_recip(BIGNUM *pr, const BIGNUM *pd, int32_t p)
+{
+BIGNUM dt, e, u;
+double dd;
+int32_t m, s, h, i;
+
+  bn_init(&dt);
+  bn_init(&e);
+  bn_init(&u);
+
+  s = pd->nLen - (p + 2);
+  bn_shr(&dt, pd, s > 0 ? s : 0);
+  m = dt.nLen;
+
+  if(p <= 1) // the top 3 limbs (at most) in floating point
+  {
+    for(dd = 0.0, i = m - 1; i >= 0 && i >= m - 3; i--)
+    {
+      dd = dd * (double)BN_BASE + (double)dt.pd[i];
+    }
+
+    bn_set_u64(pr, (uint64_t)(pow((double)BN_BASE, (double)((m < 3 ? m : 3) + p)) / dd));
+  }
+  else
+  {
+    h = p / 2 + 1 < p ? p / 2 + 1 : p - 1;
+
+    bn_recip(pr, &dt, h);
+    bn_shl(pr, pr, p - h);
+
+    bn_mul(&e, &dt, pr);
+    bn_set_pow(&u, m + p);
+    bn_sub(&e, &u, &e);
+
+    bn_mul(&e, &e, pr);
+    bn_shr(&e, &e, m + p);
+    bn_add(pr, pr, &e);
+  }
+
+  bn_free(&dt);
+  bn_free(&e);
+  bn_free(&u);
+}
+
+void bn_invsqrt(BIGNUM *py, uint32_t c, int32_t p)
+{
+BIGNUM e, u;
+int32_t h;
+
+  if(p <= 2)
+  {
+    bn_set_u64(py, (uint64_t)(pow((double)BN_BASE, (double)p) / sqrt((double)c)));
+    return;
+  }
+
+  bn_init(&e);
+  bn_init(&u);
+
+  h = p / 2 + 1;
+
+  bn_invsqrt(py, c, h);
+  bn_shl(py, py, p - h);
+
+  bn_mul(&e, py, py);
+  bn_mul_small(&e, &e, c);
+  bn_set_pow(&u, 2 * p);
+  bn_sub(&e, &u, &e);
+
+  bn_mul(&e, &e, py);
+  bn_shr(&e, &e, 2 * p);
+  bn_div_small(&e, &e, 2);
+  bn_add(py, py, &e);
+
+  bn_free(&e);
+  bn_free(&u);
+}
+
+// q = floor(n / d) for positive 'n' and 'd':  multiply by the reciprocal, then fix the last
+// few units with the exact remainder
+
+void bn_div(BIGNUM *pq, const BIGNUM *pn, const BIGNUM *pd)
+{
+BIGNUM q, r, nt, rem, one;
+int32_t m, nq, s;
+
+  bn_init(&q);
+  bn_init(&r);
+  bn_init(&nt);
+  bn_init(&rem);
+  bn_init(&one);
+  bn_set_u64(&one, 1);
+
+  m = pd->nLen;
+  nq = pn->nLen - m + 1; // limbs in the quotient, give or take one
+
+  if(nq > 0)
+  {
+    bn_recip(&r, pd, nq + 1); // BASE^(m + nq + 1) / d
+
+    s = pn->nLen - (nq + 2);
+    s = s > 0 ? s : 0;
+    bn_shr(&nt, pn, s);
+    bn_mul(&nt, &nt, &r);
+    bn_shr(&q, &nt, m + nq + 1 - s);
+  }
+
+  bn_mul(&rem, &q, pd);
+  bn_sub(&rem, pn, &rem);
+
+  while(rem.nSign < 0)
+  {
+    bn_sub(&q, &q, &one);
+    bn_add(&rem, &rem, pd);
+  }
+
+  while(lv_cmp(rem.pd, rem.nLen, pd->pd, pd->nLen) >= 0)
+  {
+    bn_add(&q, &q, &one);
+    bn_sub(&rem, &rem, pd);
+  }
+
+  bn_take(pq, &q);
+
+  bn_free(&r);
+  bn_free(&nt);
+  bn_free(&rem);
+  bn_free(&one);
+}
+
+// s = floor(sqrt(c * BASE^(2p))), from 'bn_invsqrt' and then exact
+
+void bn_isqrt_scaled(BIGNUM *ps, uint32_t c, int32_t p)
+{
+BIGNUM rem, t, one;
+
+  bn_init(&rem);
+  bn_init(&t);
+  bn_init(&one);
+  bn_set_u64(&one, 1);
+
+  bn_invsqrt(ps, c, p + 1);
+  bn_mul_small(ps, ps, c);
+  bn_shr(ps, ps, 1);
+
+  // rem = c BASE^2p - s^2, which has to end up between 0 and 2s
+  bn_set_pow(&rem, 2 * p);
+  bn_mul_small(&rem, &rem, c);
+  bn_mul(&t, ps, ps);
+  bn_sub(&rem, &rem, &t);
+
+  while(rem.nSign < 0)
+  {
+    bn_sub(ps, ps, &one);
+    bn_add(&rem, &rem, ps);
+    bn_add(&rem, &rem, ps);
+    bn_add(&rem, &rem, &one);
+  }
+
+  for(;;)
+  {
+    bn_add(&t, ps, ps);
+
+    if(lv_cmp(rem.pd, rem.nLen, t.pd, t.nLen) <= 0)
+    {
+      break;
+    }
+
+    bn_sub(&rem, &rem, &t);
+    bn_sub(&rem, &rem, &one);
+    bn_add(ps, ps, &one);
+  }
+
+  bn_free(&rem);
+  bn_free(&t);
+  bn_free(&one);
+}
+
+// BINARY SPLITTING - P, Q and T for terms a through b - 1 of the series.  Each half of the
+// range is done separately and then combined:
+//
+//   P = P1 P2,  Q = Q1 Q2,  T = T1 Q2 + P1 T2
+//
+// The top 'nDepth' levels of the tree give their left half to a new thread, so the tree
+// spreads over the cores, and the combine at those levels overlaps Q with T as well
+
+typedef struct _CHUD_SPLIT_
+{
+  int64_t a, b;  // terms a through b - 1
+  BIGNUM P, Q, T;
+  int bNeedP;    // P isn't needed for the right edge of the tree
+  int nDepth;    // levels left that get their own threads
+} CHUD_SPLIT;
+
+typedef struct _BN_MUL_JOB_
+{
+  BIGNUM *pr;
+  const BIGNUM *pa, *pb;
+} BN_MUL_JOB;
+
+void *bn_mul_proc(void *pArg)
+{
+BN_MUL_JOB *pJ = (BN_MUL_JOB *)pArg;
+
+  bn_mul(pJ->pr, pJ->pa, pJ->pb);
+
+  return NULL;
+}
+
+void chud_split(CHUD_SPLIT *pS);
+
+void *chud_split_proc(void *pArg)
+{
+  chud_split((CHUD_SPLIT *)pArg);
+
+  return NULL;
+}
+
+void chud_split(CHUD_SPLIT *pS)
+{
+CHUD_SPLIT sL, sR;
+BIGNUM t;
+BN_MUL_JOB job;
+int64_t a = pS->a, m;
+#ifdef USE_THREAD
+pthread_t idThread;
+int bThread = 0;
+#endif // USE_THREAD
+
+  bn_init(&(pS->P));
+  bn_init(&(pS->Q));
+  bn_init(&(pS->T));
+
+  if(pS->b - a == 1) // one term
+  {
+    if(!a)
+    {
+      bn_set_u64(&(pS->P), 1);
+      bn_set_u64(&(pS->Q), 1);
+      bn_set_u64(&(pS->T), 13591409L);
+    }
+    else
+    {
+      // P = -(6a - 5)(2a - 1)(6a - 1),  Q = a^3 640320^3 / 24,  T = P (13591409 + 545140134 a)
+      bn_set_u64(&(pS->P), (uint64_t)(6 * a - 5) * (uint64_t)(2 * a - 1));
+      bn_mul_small(&(pS->P), &(pS->P), (uint32_t)(6 * a - 1));
+      pS->P.nSign = -1;
+
+      bn_set_u64(&(pS->Q), 10939058860032000ULL);
+      bn_mul_small(&(pS->Q), &(pS->Q), (uint32_t)a);
+      bn_mul_small(&(pS->Q), &(pS->Q), (uint32_t)a);
+      bn_mul_small(&(pS->Q), &(pS->Q), (uint32_t)a);
+
+      bn_init(&t);
+      bn_set_u64(&t, 13591409ULL + 545140134ULL * (uint64_t)a);
+      bn_mul(&(pS->T), &(pS->P), &t);
+      bn_free(&t);
+    }
+
+    return;
+  }
+
+  m = (a + pS->b) / 2;
+
+  sL.a = a;
+  sL.b = m;
+  sL.bNeedP = 1;
+  sL.nDepth = pS->nDepth - 1;
+
+  sR.a = m;
+  sR.b = pS->b;
+  sR.bNeedP = pS->bNeedP;
+  sR.nDepth = pS->nDepth - 1;
+
+#ifdef USE_THREAD
+  bThread = pS->nDepth > 0 && run_spawn(&idThread, chud_split_proc, &sL);
+#endif // USE_THREAD
+
+  chud_split(&sR);
+
+#ifdef USE_THREAD
+  if(bThread)
+  {
+    run_join(idThread);
+  }
+  else
+#endif // USE_THREAD
+  {
+    chud_split(&sL);
+  }
+
+  bn_init(&t);
+
+  // Q = Q1 Q2, in another thread near the top of the tree
+  job.pr = &(pS->Q);
+  job.pa = &(sL.Q);
+  job.pb = &(sR.Q);
+
+#ifdef USE_THREAD
+  bThread = pS->nDepth > 0 && run_spawn(&idThread, bn_mul_proc, &job);
+  if(!bThread)
+#endif // USE_THREAD
+  {
+    bn_mul_proc(&job);
+  }
+
+  bn_mul(&(pS->T), &(sL.T), &(sR.Q));
+  bn_mul(&t, &(sL.P), &(sR.T));
+  bn_add(&(pS->T), &(pS->T), &t);
+
+  if(pS->bNeedP)
+  {
+    bn_mul(&(pS->P), &(sL.P), &(sR.P));
+  }
+
+#ifdef USE_THREAD
+  if(bThread)
+  {
+    run_join(idThread);
+  }
+#endif // USE_THREAD
+
+  bn_free(&t);
+  bn_free(&(sL.P)); bn_free(&(sL.Q)); bn_free(&(sL.T));
+  bn_free(&(sR.P)); bn_free(&(sR.Q)); bn_free(&(sR.T));
+}
+
+// the whole thing, prints the digits the same way the spigot does
+
+void chud_run(PI_ENGINE *pE)
+{
+CHUD_SPLIT sTop;
+BIGNUM s, x;
+int32_t nLimbs, e, i, i1;
+char tbuf[BN_DIGITS];
+uint32_t w;
+uint64_t ullT0, ullT1;
+
+  ntt_init();
+
+  pE->nChudThreads = 1;
+#ifdef USE_THREAD
+  pE->nChudThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  pE->nChudThreads = pE->nChudThreads > 0 ? pE->nChudThreads : 1;
+  pE->nChudThreads = pE->nChudMaxThreads && pE->nChudMaxThreads < pE->nChudThreads ? pE->nChudMaxThreads : pE->nChudThreads;
+#endif // USE_THREAD
+
+  nLimbs = (pE->n + BN_DIGITS - 1) / BN_DIGITS + 2; // 2 guard limbs
+
+  sTop.a = 0;
+  sTop.b = (int64_t)((double)nLimbs * BN_DIGITS / CHUD_DIGITS_PER_TERM) + 2;
+  sTop.bNeedP = 0;
+  for(sTop.nDepth = 0; (1 << sTop.nDepth) < pE->nChudThreads; sTop.nDepth++)
+    ;
+
+  ullT0 = bPhaseTimes ? ns_clock() : 0;
+  chud_split(&sTop);
+
+  if(bPhaseTimes)
+  {
+    ullT1 = ns_clock();
+    aullPhaseNs[PH_SWEEP] += ullT1 - ullT0;
+    ullT0 = ullT1;
+  }
+
+  bn_init(&s);
+  bn_init(&x);
+
+  // only the top 'nLimbs' + 4 of Q and T matter, and cutting both the same keeps Q / T
+  e = (sTop.Q.nLen < sTop.T.nLen ? sTop.Q.nLen : sTop.T.nLen) - (nLimbs + 4);
+  if(e > 0)
+  {
+    bn_shr(&(sTop.Q), &(sTop.Q), e);
+    bn_shr(&(sTop.T), &(sTop.T), e);
+  }
+
+  // x = 426880 sqrt(10005) Q / T, which is pi * BASE^nLimbs
+  bn_isqrt_scaled(&s, 10005, nLimbs);
+  bn_mul(&x, &s, &(sTop.Q));
+  bn_mul_small(&x, &x, 426880L);
+  bn_div(&x, &x, &(sTop.T));
+
+  if(bPhaseTimes)
+  {
+    ullT1 = ns_clock();
+    aullPhaseNs[PH_COMBINE] += ullT1 - ullT0;
+    ullT0 = ullT1;
+  }
+
+  if(!pE->bOutPacked && !pE->bOutQuiet)
+  {
+    printf("\n 3.");
+  }
+
+  // the fraction, 9 digits per limb from the top
+  for(i = nLimbs - 1; i >= 0 && pE->cnt < pE->n; i--)
+  {
+    w = i < x.nLen ? x.pd[i] : 0;
+
+    for(i1 = BN_DIGITS - 1; i1 >= 0; i1--)
+    {
+      tbuf[i1] = (char)(w % 10);
+      w /= 10;
+    }
+
+    for(i1 = 0; i1 < BN_DIGITS; i1++)
+    {
+      yprint(pE, tbuf[i1]);
+    }
+  }
+
+  if(bPhaseTimes) // the digits, and any waiting on the writer, the writes count themselves
+  {
+    aullPhaseNs[PH_COMBINE] += ns_clock() - ullT0;
+  }
+
+  bn_free(&s);
+  bn_free(&x);
+  bn_free(&(sTop.P));
+  bn_free(&(sTop.Q));
+  bn_free(&(sTop.T));
+}
+
+// BBP ('-x' and '--verify') - the Bailey-Borwein-Plouffe formula
+//
+//   pi = sum 16^-k (4/(8k+1) - 2/(8k+4) - 1/(8k+5) - 1/(8k+6))
+//
+// gives the HEX digits of pi at any position without the ones before it.  Multiplying by
+// 16^d and keeping only the fraction turns the first d terms into modular powers of 16, so
+// it's O(d) time and no memory.  The work for each position is cut into chunks of terms
+// and the chunks are spread over the cores.
+//
+// '--verify' uses it to spot-check a finished run.  The decimal digits in the file are
+// converted to hex at a few positions (with the Chudnovsky bignums, see 'dec_to_hex') and
+// compared with BBP.  Hex digit p depends on EVERY decimal digit up to about 1.2 p, so a
+// position near the end checks nearly the whole file, like the errors around digit 89,000
+// in the header.  Checking a position costs about log2(p) multiplies the size of the file,
+// which is seconds for millions of digits instead of a whole new run.
+
+#define BBP_HEX_DIGITS 8     /* hex digits shown for each position */
+#define BBP_CHECK_DIGITS 6   /* how many of those '--verify' compares, the last ones can be off */
+#define BBP_CHUNK 1000000L   /* terms per chunk of work */
+#define VERIFY_SAMPLES 8     /* default number of positions '--verify' checks */
+
+#ifdef HAS_INT128
+#define BBP_MAX_POS 4000000000L /* the sums lose precision past this */
+#else  // HAS_INT128
+#define BBP_MAX_POS 500000000L  /* so that 8k + 6 fits in 32 bits (see 'pow16_mod') */
+#endif // HAS_INT128
+
+typedef struct _BBP_JOB_
+{
+  int64_t d;         // the position, less 1
+  int64_t k0, k1;    // terms k0 through k1 - 1
+  long double s[4];  // fractions of the 1, 4, 5 and 6 sums
+} BBP_JOB;
+
+BBP_JOB *pBbpJobs;
+int32_t nBbpJobs;
+volatile int32_t nJobNext;           // the next job for 'run_jobs'
+void (*pfnJob)(int32_t nJob);        // what each job does
+
+// a * b mod m for m < 2^32, a and b < m.  The quotient from a 'double' is off by at most 1,
+// which is a lot cheaper than a 64-bit 'div'
+
+__inline uint64_t mul_mod32(uint64_t a, uint64_t b, uint64_t m, double dInv)
+{
+uint64_t q = (uint64_t)(int64_t)((double)(int64_t)a * (double)(int64_t)b * dInv); // signed converts are cheaper
+int64_t r = (int64_t)(a * b - q * m);
+
+  if(r < 0)
+  {
+    r += m;
+  }
+  else if(r >= (int64_t)m)
+  {
+    r -= m;
+  }
+
+  return (uint64_t)r;
+}
+
+// 16^e mod m
+
+uint64_t pow16_mod(uint64_t e, uint64_t m)
+{
+uint64_t r = 1 % m, b = 16 % m;
+double dInv = 1.0 / (double)(int64_t)m;
+
+  while(e)
+  {
+#ifdef HAS_INT128
+    if(m > 0xffffffffUL)
+    {
+      if(e & 1)
+      {
+        r = (uint64_t)((unsigned __int128)r * b % m);
+      }
+
+      b = (uint64_t)((unsigned __int128)b * b % m);
+      e >>= 1;
+      continue;
+    }
+#endif // HAS_INT128
+
+    if(e & 1)
+    {
+      r = mul_mod32(r, b, m, dInv);
+    }
+
+    b = mul_mod32(b, b, m, dInv);
+    e >>= 1;
+  }
+
+  return r;
+}
+
+// 16^e mod 8k + 1, 8k + 4, 8k + 5 and 8k + 6 all at once.  Each 'pow16_mod' is one long
+// chain of dependent multiplies, 4 of them side by side keep the CPU busy while they wait
+
+void pow16_mod4(uint64_t e, uint64_t k, uint64_t *pr)
+{
+uint64_t r0, r1, r2, r3, b0, b1, b2, b3, m0 = 8 * k + 1, m1 = 8 * k + 4, m2 = 8 * k + 5, m3 = 8 * k + 6;
+double d0, d1, d2, d3;
+
+  if(k < 2 || m3 > 0xffffffffUL) // 16 isn't below all of them, or too big for 'mul_mod32'
+  {
+    pr[0] = pow16_mod(e, m0);
+    pr[1] = pow16_mod(e, m1);
+    pr[2] = pow16_mod(e, m2);
+    pr[3] = pow16_mod(e, m3);
+    return;
+  }
+
+  d0 = 1.0 / (double)(int64_t)m0;
+  d1 = 1.0 / (double)(int64_t)m1;
+  d2 = 1.0 / (double)(int64_t)m2;
+  d3 = 1.0 / (double)(int64_t)m3;
+
+  r0 = r1 = r2 = r3 = 1;
+  b0 = b1 = b2 = b3 = 16;
+
+  while(e)
+  {
+    if(e & 1)
+    {
+      r0 = mul_mod32(r0, b0, m0, d0);
+      r1 = mul_mod32(r1, b1, m1, d1);
+      r2 = mul_mod32(r2, b2, m2, d2);
+      r3 = mul_mod32(r3, b3, m3, d3);
+    }
+
+    b0 = mul_mod32(b0, b0, m0, d0);
+    b1 = mul_mod32(b1, b1, m1, d1);
+    b2 = mul_mod32(b2, b2, m2, d2);
+    b3 = mul_mod32(b3, b3, m3, d3);
+    e >>= 1;
+  }
+
+  pr[0] = r0;
+  pr[1] = r1;
+  pr[2] = r2;
+  pr[3] = r3;
+}
+
+// one chunk of the 4 sums:  frac(sum 16^(d-k) / (8k + j)) for k0 <= k < k1 (k1 <= d + 1)
+
+void bbp_job(int32_t nJob)
+{
+BBP_JOB *pJ = pBbpJobs + nJob;
+static const int aj[4] = { 1, 4, 5, 6 };
+long double s[4] = { 0.0L, 0.0L, 0.0L, 0.0L };
+uint64_t ar[4];
+int64_t k;
+int i1;
+
+  for(k = pJ->k0; k < pJ->k1; k++)
+  {
+    pow16_mod4(pJ->d - k, k, ar);
+
+    for(i1 = 0; i1 < 4; i1++)
+    {
+      s[i1] += (long double)ar[i1] / (long double)(8 * k + aj[i1]);
+
+      if(s[i1] >= 1.0L) // every term is under 1
+      {
+        s[i1] -= 1.0L;
+      }
+    }
+  }
+
+  for(i1 = 0; i1 < 4; i1++)
+  {
+    pJ->s[i1] = s[i1];
+  }
+}
+
+#ifdef USE_THREAD
+void *job_thread_proc(void *pArg)
+{
+int32_t nJob;
+
+  (void)pArg;
+
+  while((nJob = __atomic_fetch_add(&nJobNext, 1, __ATOMIC_SEQ_CST)) < nBbpJobs)
+  {
+    pfnJob(nJob);
+  }
+
+  return NULL;
+}
+#endif // USE_THREAD
+
+// runs jobs 0 through nJobs - 1 of 'pfn' on every core
+
+void run_jobs(int32_t nJobs, void (*pfn)(int32_t))
+{
+#ifdef USE_THREAD
+pthread_t aThreads[64];
+int nThreads, i1, nStarted;
+#else  // USE_THREAD
+int32_t nJob;
+#endif // USE_THREAD
+
+  pfnJob = pfn;
+  nBbpJobs = nJobs;
+  nJobNext = 0;
+
+#ifdef USE_THREAD
+  nThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  nThreads = nThreads > 64 ? 64 : nThreads;
+
+  for(nStarted = 0, i1 = 1; i1 < nThreads && i1 < nJobs; i1++)
+  {
+    if(pthread_create(aThreads + nStarted, NULL, job_thread_proc, NULL))
+    {
+      break; // run anyway, with what did start
+    }
+
+    nStarted++;
+  }
+
+  job_thread_proc(NULL);
+
+  for(i1 = 0; i1 < nStarted; i1++)
+  {
+    pthread_join(aThreads[i1], NULL);
+  }
+#else  // USE_THREAD
+  for(nJob = 0; nJob < nJobs; nJob++)
+  {
+    pfn(nJob);
+  }
+#endif // USE_THREAD
+}
+
+// the BBP_HEX_DIGITS hex digits of pi starting at each of 'nPos' positions (1 is the first
+// one after the point), as 32-bit values
+
+void bbp_hex(const int64_t *pPos, int nPos, uint32_t *pHex)
+{
+static const int aj[4] = { 1, 4, 5, 6 };
+static const long double ac[4] = { 4.0L, -2.0L, -1.0L, -1.0L };
+long double s[4], t, x;
+int64_t d, k;
+int32_t nJobs, nJob;
+int i1, i2, i3;
+
+  for(nJobs = 0, i1 = 0; i1 < nPos; i1++)
+  {
+    nJobs += (int32_t)((pPos[i1] - 1 + BBP_CHUNK) / BBP_CHUNK); // chunks of 0 .. d - 1
+  }
+
+  pBbpJobs = (BBP_JOB *)Fcalloc((Size_T)(nJobs + 1), (Size_T)sizeof(BBP_JOB));
+  if(!pBbpJobs)
+  {
+    memerr(MAX_SERIES + 3);
+  }
+
+  for(nJob = 0, i1 = 0; i1 < nPos; i1++)
+  {
+    for(k = 0, d = pPos[i1] - 1; k < d; k += BBP_CHUNK)
+    {
+      pBbpJobs[nJob].d = d;
+      pBbpJobs[nJob].k0 = k;
+      pBbpJobs[nJob].k1 = k + BBP_CHUNK < d ? k + BBP_CHUNK : d;
+      nJob++;
+    }
+  }
+
+  run_jobs(nJobs, bbp_job);
+
+  for(nJob = 0, i1 = 0; i1 < nPos; i1++)
+  {
+    d = pPos[i1] - 1;
+
+    for(i2 = 0; i2 < 4; i2++)
+    {
+      s[i2] = 0.0L;
+    }
+
+    for(; nJob < nJobs && pBbpJobs[nJob].d == d && pBbpJobs[nJob].k0 < d; nJob++)
+    {
+      for(i2 = 0; i2 < 4; i2++)
+      {
+        s[i2] += pBbpJobs[nJob].s[i2];
+      }
+    }
+
+    // the tail, where 16^(d-k) is a fraction, is short
+    for(i2 = 0; i2 < 4; i2++)
+    {
+      for(k = d; k <= d + 30; k++)
+      {
+        s[i2] += powl(16.0L, (long double)(d - k)) / (long double)(8 * k + aj[i2]);
+      }
+    }
+
+    for(x = 0.0L, i2 = 0; i2 < 4; i2++)
+    {
+      x += ac[i2] * (s[i2] - floorl(s[i2]));
+    }
+
+    x -= floorl(x);
+
+    for(pHex[i1] = 0, i3 = 0; i3 < BBP_HEX_DIGITS; i3++)
+    {
+      x *= 16.0L;
+      t = floorl(x);
+      pHex[i1] = (pHex[i1] << 4) | (uint32_t)t;
+      x -= t;
+    }
+  }
+
+  Ffree(pBbpJobs);
+  pBbpJobs = NULL;
+}
+
+// p = p mod 10^m
+
+void bn_mod_pow10(BIGNUM *p, int32_t m)
+{
+static const uint32_t aPow10[BN_DIGITS] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+int32_t nFull = m / BN_DIGITS, nPart = m % BN_DIGITS;
+
+  if(p->nLen > nFull)
+  {
+    if(nPart)
+    {
+      p->pd[nFull] %= aPow10[nPart];
+      p->nLen = nFull + 1;
+    }
+    else
+    {
+      p->nLen = nFull;
+    }
+
+    p->nLen = lv_trim(p->pd, p->nLen);
+  }
+}
+
+// decimal digit 'k' of 'p' (0 is the units)
+
+int bn_digit(const BIGNUM *p, int32_t k)
+{
+uint32_t w = k / BN_DIGITS < p->nLen ? p->pd[k / BN_DIGITS] : 0;
+
+  for(k %= BN_DIGITS; k > 0; k--)
+  {
+    w /= 10;
+  }
+
+  return (int)(w % 10);
+}
+
+// the verify state, one entry per position checked
+
+const char *pVerifyDigits; // the digits after the decimal point, as '0' to '9'
+int32_t nVerifyDigits;
+BIGNUM bnVerify;           // the same digits as one number
+int64_t *pVerifyPos;
+uint32_t *pVerifyHex;      // hex digits from the file, 'bbp_hex' format
+
+// DEC_TO_HEX - with F = N / 10^D (the D digits from the file), the hex digits starting at
+// 'p' are floor(16^(p+7) N / 10^D) mod 16^8.  16^8 divides 10^32, so only the 32 decimal
+// digits of 16^(p+7) N just above the bottom D are needed, which is everything mod 10^(D+32).
+// In base 10^9 a 'mod 10^m' just drops limbs, so it's all multiplies
+
+void dec_to_hex(int32_t nJob)
+{
+BIGNUM r;
+int64_t e = pVerifyPos[nJob] + BBP_HEX_DIGITS - 1;
+int32_t m = nVerifyDigits + 32, k;
+uint32_t v;
+int nBit;
+
+  bn_init(&r);
+  bn_set_u64(&r, 1);
+
+  for(nBit = 62; nBit >= 0; nBit--) // 16^e mod 10^m
+  {
+    bn_mul(&r, &r, &r);
+    bn_mod_pow10(&r, m);
+
+    if((e >> nBit) & 1)
+    {
+      bn_mul_small(&r, &r, 16);
+      bn_mod_pow10(&r, m);
+    }
+  }
+
+  bn_mul(&r, &r, &bnVerify);
+  bn_mod_pow10(&r, m);
+
+  for(v = 0, k = m - 1; k >= nVerifyDigits; k--) // wraps mod 2^32, which is what's wanted
+  {
+    v = v * 10 + bn_digit(&r, k);
+  }
+
+  pVerifyHex[nJob] = v;
+
+  bn_free(&r);
+}
+
+// checks 'nSamples' positions of the pi output in file 'pName'.  returns 0 if they all match
+
+int verify_run(const char *pName, int nSamples)
+{
+FILE *pF;
+char *pBuf, *p1, *pDigits;
+long cbFile;
+int32_t i, nLimb;
+int64_t nMaxPos;
+uint32_t *pHex, wMask;
+int i1, nBad;
+
+  if(NULL == (pF = fopen(pName, "rb")))
+  {
+    fprintf(stderr, "\nCan't open '%s'\n", pName);
+    return (1);
+  }
+
+  fseek(pF, 0L, SEEK_END);
+  cbFile = ftell(pF);
+  fseek(pF, 0L, SEEK_SET);
+
+  pBuf = (char *)Fcalloc((Size_T)(cbFile + 1), (Size_T)1);
+  if(!pBuf || fread(pBuf, 1, cbFile, pF) != (size_t)cbFile)
+  {
+    fprintf(stderr, "\nCan't read '%s'\n", pName);
+    fclose(pF);
+    return (1);
+  }
+
+  fclose(pF);
+
+  // the digits follow ' 3.', spaces and newlines in between are just the layout
+  if(NULL == (p1 = strstr(pBuf, " 3.")))
+  {
+    fprintf(stderr, "\n'%s' doesn't look like the output of this program\n", pName);
+    return (1);
+  }
+
+  for(pDigits = pBuf, nVerifyDigits = 0, p1 += 3; *p1; p1++)
+  {
+    if(*p1 >= '0' && *p1 <= '9')
+    {
+      pDigits[nVerifyDigits++] = *p1; // packs them in place, they're always behind 'p1'
+    }
+    else if(*p1 != ' ' && *p1 != '\n' && *p1 != '\r')
+    {
+      break;
+    }
+  }
+
+  pVerifyDigits = pDigits;
+
+  // the last few decimal digits could be off by the truncation, so stay clear of them
+  nMaxPos = (int64_t)((nVerifyDigits - 20) * (log(10.0) / log(16.0))) - BBP_HEX_DIGITS;
+  if(nMaxPos > BBP_MAX_POS)
+  {
+    nMaxPos = BBP_MAX_POS;
+  }
+
+  if(nMaxPos < 1 || nSamples < 1)
+  {
+    fprintf(stderr, "\nnot enough digits in '%s' to check\n", pName);
+    return (1);
+  }
+
+  if(nSamples > nMaxPos)
+  {
+    nSamples = (int)nMaxPos;
+  }
+
+  printf("\nVerifying %ld digits in '%s' at %d hex positions\n\n", (long)nVerifyDigits, pName, nSamples);
+
+  pVerifyPos = (int64_t *)Fcalloc((Size_T)nSamples, (Size_T)sizeof(int64_t));
+  pVerifyHex = (uint32_t *)Fcalloc((Size_T)nSamples, (Size_T)sizeof(uint32_t));
+  pHex = (uint32_t *)Fcalloc((Size_T)nSamples, (Size_T)sizeof(uint32_t));
+  if(!pVerifyPos || !pVerifyHex || !pHex)
+  {
+    memerr(MAX_SERIES + 3);
+  }
+
+  // spread out, and the last one as far out as it can go
+  for(i1 = 0; i1 < nSamples; i1++)
+  {
+    pVerifyPos[i1] = 1 + (nMaxPos - 1) * (i1 + 1) / nSamples;
+  }
+
+  // the digits as one number, 9 to a limb from the bottom
+  bn_init(&bnVerify);
+  nLimb = (nVerifyDigits + BN_DIGITS - 1) / BN_DIGITS;
+  bn_reserve(&bnVerify, nLimb);
+
+  for(i = 0; i < nLimb; i++)
+  {
+    int32_t j0 = nVerifyDigits - (i + 1) * BN_DIGITS, j;
+    uint32_t w = 0;
+
+    for(j = j0 > 0 ? j0 : 0; j < j0 + BN_DIGITS; j++)
+    {
+      w = w * 10 + (pVerifyDigits[j] - '0');
+    }
+
+    bnVerify.pd[i] = w;
+  }
+
+  bnVerify.nLen = lv_trim(bnVerify.pd, nLimb);
+
+  ntt_init(); // no engine, so the NTT has one thread, the positions are the parallel part
+
+  bbp_hex(pVerifyPos, nSamples, pHex);
+  run_jobs(nSamples, dec_to_hex);
+
+  wMask = ~(uint32_t)0 << (4 * (BBP_HEX_DIGITS - BBP_CHECK_DIGITS));
+
+  for(nBad = 0, i1 = 0; i1 < nSamples; i1++)
+  {
+    int bOk = !((pHex[i1] ^ pVerifyHex[i1]) & wMask);
+
+    printf("  hex position %10ld:  BBP %08lX  file %08lX  %s\n", (long)pVerifyPos[i1],
+           (unsigned long)pHex[i1], (unsigned long)pVerifyHex[i1], bOk ? "ok" : "MISMATCH");
+
+    nBad += !bOk;
+  }
+
+  if(nBad)
+  {
+    for(i1 = 0; !((pHex[i1] ^ pVerifyHex[i1]) & wMask); i1++)
+    {
+      ;
+    }
+
+    // a digit that's off changes every hex digit after its own position
+    printf("\n%d of %d positions DON'T match, the first bad digit is ", nBad, nSamples);
+    if(i1)
+    {
+      printf("after about decimal digit %ld and ", (long)(pVerifyPos[i1 - 1] * (log(16.0) / log(10.0))));
+    }
+    printf("before decimal digit %ld\n", (long)((pVerifyPos[i1] + BBP_HEX_DIGITS) * (log(16.0) / log(10.0))) + 2);
+  }
+  else
+  {
+    printf("\nAll %d positions match\n", nSamples);
+  }
+
+  bn_free(&bnVerify);
+  Ffree(pHex);
+  Ffree(pVerifyHex);
+  Ffree(pVerifyPos);
+  Ffree(pBuf);
+
+  return nBad ? 2 : 0;
+}
+
+// '-x', prints the hex digits at each position in the comma separated list 'pList'
+
+int hex_run(const char *pList)
+{
+int64_t aPos[64] = { 0 };
+uint32_t aHex[64];
+char *endp;
+int nPos, i1;
+
+  for(nPos = 0; *pList && nPos < 64; pList = *endp ? endp + 1 : endp)
+  {
+    aPos[nPos] = strtol(pList, &endp, 10);
+
+    if(endp == pList || (*endp && *endp != ',') || aPos[nPos] < 1 || aPos[nPos] > BBP_MAX_POS)
+    {
+      fprintf(stderr, "\n'-x' positions must be between 1 and %ld\n", (long)BBP_MAX_POS);
+      return (1);
+    }
+
+    nPos++;
+  }
+
+  bbp_hex(aPos, nPos, aHex);
+
+  printf("\nHex digits of PI\n\n");
+
+  for(i1 = 0; i1 < nPos; i1++)
+  {
+    printf("  position %10ld:  %08lX\n", (long)aPos[i1], (unsigned long)aHex[i1]);
+  }
+
+  return (0);
+}
+
+// CHECKPOINTS ('-s' and '--resume') - every '-s' seconds of wall time the spigot's state
+// goes to a file:  the live terms of each series (see 'series_len'), 'stor[]' with the
+// digits still held for carries, and where the output stands.  The output is flushed
+// first ('out_sync') so the file and the checkpoint agree.  Then a 'fork'ed copy of the
+// process writes the checkpoint while this one keeps going, so the pause is about the
+// flush plus the 'fork', not the whole write.  The copy-on-write pages are the price.
+// The copy has only the thread that forked, and the others may have been holding the
+// stdio or malloc locks, so it does nothing but system calls ('ckpt_write_raw').
+// It goes to a '.tmp' file that's renamed over the old one when it's complete, so a kill
+// in the middle of a checkpoint still leaves the previous one.
+//
+// 'pi --resume [file] >> output' picks up from it.  Whatever the killed run wrote after
+// the checkpoint is cut off the output first, so the digits carry on where they should.
+// A run that finishes deletes its checkpoint.  The Chudnovsky engine and the wavefront
+// sweeps ('-t') don't stop between sweeps, checkpoints start after them.
+
+#define CKPT_NAME "pi.ckp"
+#define CKPT_MAGIC "PICKPT01"
+
+typedef struct _CKPT_HEADER_
+{
+  char szMagic[8];
+  int32_t n, nChunk, nSweeps, cnt, loc, col, col1, nSeries;
+  int32_t bRecip, nCkptSecs;
+  int64_t llOutPos;             // where the output stood ('out_sync'), -1 if it isn't a file
+  int32_t nOutHalf;             // the half written '-o' byte, -1 if there isn't one
+  int32_t anLen[MAX_SERIES];    // the sweep lengths, terms 0 through 'anLen + 2' are saved
+  int64_t ac[MAX_SERIES], ax[MAX_SERIES];
+  char szOut[1024];             // the '-o' file, empty for stdout
+  int32_t stor[STOR_SIZE];
+} CKPT_HEADER;
+
+const char *pCkptName = CKPT_NAME;
+const char *pCkptOut;            // the '-o' file, to save in the checkpoint
+CKPT_HEADER ckResume;            // what '--resume' read
+FILE *pfResume;                  // and where the terms are, NULL if it's not resuming
+#ifndef _WIN32
+pid_t pidCkpt;                   // the copy still writing the last one
+int32_t nCkptCnt;                // and the digits it's at
+#endif // _WIN32
+
+unsigned int ckpt_tick(void)
+{
+#ifdef _WIN32
+  return GetTickCount();
+#else  // _WIN32
+  return MyGetTickCount();
+#endif // _WIN32
+}
+
+// writes the checkpoint file, returns 0 if it couldn't
+
+int ckpt_write(PI_ENGINE *pE, const CKPT_HEADER *pH)
+{
+char szTmp[1100];
+unsigned int dwStart = ckpt_tick();
+FILE *pF;
+Size_T cb = sizeof(CKPT_HEADER);
+int s, bOk;
+
+  snprintf(szTmp, sizeof(szTmp), "%s.tmp", pCkptName);
+
+  if(NULL == (pF = fopen(szTmp, "wb")))
+  {
+    fprintf(stderr, "NOTE:  can't create checkpoint '%s'\n", szTmp);
+    return (0);
+  }
+
+  bOk = fwrite(pH, sizeof(CKPT_HEADER), 1, pF) == 1;
+
+  for(s = 0; bOk && s < pH->nSeries; s++)
+  {
+    bOk = fwrite(pE->aSeries[s].pa, sizeof(int64_t), pH->anLen[s] + 3, pF) == (size_t)(pH->anLen[s] + 3);
+    cb += (pH->anLen[s] + 3) * sizeof(int64_t);
+  }
+
+  bOk = !fclose(pF) && bOk;
+
+  if(!bOk || rename(szTmp, pCkptName))
+  {
+    fprintf(stderr, "NOTE:  checkpoint '%s' failed\n", pCkptName);
+    remove(szTmp);
+    return (0);
+  }
+
+  fprintf(stderr, "NOTE:  checkpoint at %ld digits, %lu bytes written in %lu msecs\n",
+          (long)pH->cnt, (unsigned long)cb, (unsigned long)(ckpt_tick() - dwStart));
+
+  return (1);
+}
+
+#ifndef _WIN32
+// writes the checkpoint to 'pTmp' and renames it to 'pName' with nothing but system calls,
+// so the 'fork'ed copy can do it.  returns 0 if it couldn't
+
+int ckpt_write_raw(PI_ENGINE *pE, const char *pTmp, const char *pName, const CKPT_HEADER *pH)
+{
+const char *p1;
+Size_T cb;
+ssize_t cbDone;
+int hF, s, bOk;
+
+  if((hF = open(pTmp, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0)
+  {
+    return (0);
+  }
+
+  for(bOk = 1, s = -1; bOk && s < pH->nSeries; s++) // the header, then each series' terms
+  {
+    p1 = s < 0 ? (const char *)pH : (const char *)pE->aSeries[s].pa;
+    cb = s < 0 ? sizeof(CKPT_HEADER) : (pH->anLen[s] + 3) * sizeof(int64_t);
+
+    for(; bOk && cb > 0; p1 += cbDone, cb -= cbDone)
+    {
+      cbDone = write(hF, p1, cb);
+      bOk = cbDone > 0;
+    }
+  }
+
+  bOk = !close(hF) && bOk;
+
+  if(!bOk || rename(pTmp, pName))
+  {
+    unlink(pTmp);
+    return (0);
+  }
+
+  return (1);
+}
+
+// the copy writing the last checkpoint, if it's done (or 'bWait'), reports how it went.
+// returns 0 if it's still going
+
+int ckpt_reap(int bWait)
+{
+int nStatus;
+
+  if(pidCkpt <= 0)
+  {
+    return (1);
+  }
+
+  if(waitpid(pidCkpt, &nStatus, bWait ? 0 : WNOHANG) == 0)
+  {
+    return (0);
+  }
+
+  if(!WIFEXITED(nStatus) || WEXITSTATUS(nStatus))
+  {
+    fprintf(stderr, "NOTE:  checkpoint '%s' at %ld digits failed\n", pCkptName, (long)nCkptCnt);
+  }
+
+  pidCkpt = 0;
+  return (1);
+}
+#endif // _WIN32
+
+// takes a checkpoint after a sweep with lengths 'pLen'.  The look-ahead of 'threaded_sweep'
+// has to be off for that sweep, so nothing of the next one is in the terms yet
+
+void ckpt_save(PI_ENGINE *pE, const int32_t *pLen)
+{
+CKPT_HEADER h;
+unsigned int dwStart = ckpt_tick();
+int s, nHalf;
+
+  pE->dwCkptTick = dwStart;
+
+#ifndef _WIN32
+  if(!ckpt_reap(0))
+  {
+    fprintf(stderr, "NOTE:  the last checkpoint is still being written, skipped\n");
+    return;
+  }
+#endif // _WIN32
+
+  memset(&h, 0, sizeof(h));
+  memcpy(h.szMagic, CKPT_MAGIC, sizeof(h.szMagic));
+
+  h.n = pE->n;
+  h.nChunk = pE->nChunk;
+  h.nSweeps = pE->nSweeps;
+  h.cnt = pE->cnt;
+  h.loc = pE->loc;
+  h.col = pE->col;
+  h.col1 = pE->col1;
+  h.nSeries = pE->nSeries;
+  h.bRecip = pE->aSeries[0].pr != NULL;
+  h.nCkptSecs = pE->nCkptSecs;
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    h.anLen[s] = pLen[s];
+    h.ac[s] = pE->aSeries[s].c;
+    h.ax[s] = pE->aSeries[s].x;
+  }
+
+  if(pCkptOut)
+  {
+    strncpy(h.szOut, pCkptOut, sizeof(h.szOut) - 1);
+  }
+
+  memcpy(h.stor, pE->stor, sizeof(h.stor));
+
+  h.llOutPos = out_sync(pE, &nHalf);
+  h.nOutHalf = nHalf;
+
+#ifndef _WIN32
+  if(nTermMem != TERM_FILE) // a shared file mapping isn't copy-on-write, the copy would see the sweeps
+  {
+    char szTmp[1100];
+
+    snprintf(szTmp, sizeof(szTmp), "%s.tmp", pCkptName); // not in the copy, see above
+
+    nCkptCnt = pE->cnt;
+    pidCkpt = fork();
+
+    if(!pidCkpt)
+    {
+      _exit(ckpt_write_raw(pE, szTmp, pCkptName, &h) ? 0 : 1);
+    }
+
+    if(pidCkpt > 0)
+    {
+      fprintf(stderr, "NOTE:  checkpoint at %ld digits, paused %lu msecs\n",
+              (long)pE->cnt, (unsigned long)(ckpt_tick() - dwStart));
+      return;
+    }
+  }
+#endif // _WIN32
+
+  ckpt_write(pE, &h); // no 'fork', it has to wait for the write
+}
+
+// the run is done, the checkpoint isn't needed any more
+
+void ckpt_done(PI_ENGINE *pE)
+{
+#ifndef _WIN32
+  ckpt_reap(1);
+#endif // _WIN32
+
+  if(pE->nCkptSecs)
+  {
+    remove(pCkptName);
+  }
+}
+
+// reads the checkpoint header for '--resume' and sets up the run from it.  The terms are
+// read later, by 'ckpt_load_terms'.  returns 0 if the file isn't a checkpoint
+
+int ckpt_load(PI_ENGINE *pE, const char *pName, char *pFormula, int cbFormula, int *pbRecip, const char **ppOut)
+{
+int s;
+
+  pCkptName = pName;
+
+  if(NULL == (pfResume = fopen(pName, "rb")) ||
+     fread(&ckResume, sizeof(ckResume), 1, pfResume) != 1 ||
+     memcmp(ckResume.szMagic, CKPT_MAGIC, sizeof(ckResume.szMagic)) ||
+     ckResume.nSeries < 1 || ckResume.nSeries > MAX_SERIES)
+  {
+    fprintf(stderr, "\n'%s' isn't a checkpoint\n", pName);
+    return (0);
+  }
+
+  pE->n = ckResume.n;
+  pE->nChunk = ckResume.nChunk;
+  pE->nCkptSecs = pE->nCkptSecs ? pE->nCkptSecs : ckResume.nCkptSecs; // '-s' can change it
+  *pbRecip = ckResume.bRecip;
+  *ppOut = ckResume.szOut[0] ? ckResume.szOut : NULL;
+
+  for(*pFormula = 0, s = 0; s < ckResume.nSeries; s++) // back to 'c:x' pairs for 'set_formula'
+  {
+    snprintf(pFormula + strlen(pFormula), cbFormula - strlen(pFormula), "%s%ld:%ld",
+             s ? "," : "", (long)ckResume.ac[s], (long)ckResume.ax[s]);
+  }
+
+  return (1);
+}
+
+// puts the saved terms and digits back, after 'spigot_run' has allocated the arrays
+
+void ckpt_load_terms(PI_ENGINE *pE)
+{
+int s;
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    if(ckResume.anLen[s] > pE->aSeries[s].nLen ||
+       fread(pE->aSeries[s].pa, sizeof(int64_t), ckResume.anLen[s] + 3, pfResume) != (size_t)(ckResume.anLen[s] + 3))
+    {
+      fprintf(stderr, "\nthe checkpoint '%s' is damaged\n", pCkptName);
+      free_series(pE);
+      exit(1);
+    }
+  }
+
+  fclose(pfResume);
+  pfResume = NULL;
+
+  pE->nSweeps = ckResume.nSweeps;
+  pE->cnt = ckResume.cnt;
+  pE->loc = ckResume.loc;
+  pE->col = ckResume.col;
+  pE->col1 = ckResume.col1;
+  memcpy(pE->stor, ckResume.stor, sizeof(pE->stor));
+
+  fprintf(stderr, "NOTE:  resuming at %ld of %ld digits\n", (long)pE->cnt, (long)pE->n);
+}
+
+// TUNING ('--tune' and '-P') - 'USE_THREAD' is where the threaded sweep starts to win, from
+// one measurement on one machine.  '--tune' measures it on this one:  it times both kinds
+// of sweep at series 0 lengths from TUNE_MIN_LEN to TUNE_MAX_LEN terms, with the formula and
+// '-k' and '-r' given, and takes the shortest length past which the threads always win.
+// The result goes into a small profile file ('pi.prof' unless one is named), which '-P'
+// reads back.  'pi.prof' in the current directory is read without asking.
+
+#define TUNE_MIN_LEN 32
+#define TUNE_MAX_LEN 32768
+#define TUNE_TERMS 4000000L /* terms swept for each measurement, about */
+#define PROFILE_NAME "pi.prof"
+
+// reads a profile, returns 0 if there isn't a usable one
+
+int profile_load(const char *pName)
+{
+FILE *pF;
+char szLine[256];
+long lCpus = 0, lMin = 0;
+
+  if(NULL == (pF = fopen(pName, "r")))
+  {
+    return (0);
+  }
+
+  while(fgets(szLine, sizeof(szLine), pF))
+  {
+    sscanf(szLine, "cpus %ld", &lCpus);
+    sscanf(szLine, "thread_min %ld", &lMin);
+  }
+
+  fclose(pF);
+
+#ifdef USE_THREAD
+  if(lMin < 1 || lCpus != (long)sysconf(_SC_NPROCESSORS_ONLN))
+  {
+    fprintf(stderr, "NOTE:  profile '%s' is for another machine, ignored (run 'pi --tune')\n", pName);
+    return (0);
+  }
+
+  nThreadMin = (int32_t)lMin;
+
+  if(nThreadMin == INT32_MAX)
+  {
+    fprintf(stderr, "NOTE:  no threaded sweeps (profile '%s')\n", pName);
+  }
+  else
+  {
+    fprintf(stderr, "NOTE:  threaded sweeps from %ld terms (profile '%s')\n", lMin, pName);
+  }
+
+  return (1);
+#else  // USE_THREAD
+  return (0); // nothing to tune
+#endif // USE_THREAD
+}
+
+// '--tune', writes the profile 'pName'.  returns the exit code
+
+int tune_run(PI_ENGINE *pE, const char *pName, int bRecip)
+{
+#ifdef USE_THREAD
+int64_t aVal[MAX_SERIES];
+int32_t aLen[MAX_SERIES], l, r, nReps, nBest = INT32_MAX;
+uint64_t ullT0, ullSingle, ullThread;
+FILE *pF;
+int s, i1, bWins = 0;
+
+  // enough digits that series 0 has TUNE_MAX_LEN terms at the start
+  pE->nGuard = 8;
+  pE->n = (int32_t)(TUNE_MAX_LEN * pE->aSeries[0].dLog) + pE->nGuard + 1;
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    pE->aSeries[s].nLen = series_len(pE, pE->n, pE->aSeries[s].dLog, INT32_MAX);
+
+    if(NULL == (pE->aSeries[s].pa = (int64_t *)term_alloc((Size_T)(pE->aSeries[s].nLen + 3L) * sizeof(int64_t))))
+    {
+      memerr(1 + s);
+    }
+
+    for(i1 = 1; i1 <= (int)pE->aSeries[s].nLen; i1++) // any remainders will do
+    {
+      pE->aSeries[s].pa[i1] = (i1 * 7919L) % pE->aSeries[s].kk;
+    }
+
+#ifdef HAS_RECIP
+    if(bRecip && NULL == (pE->aSeries[s].pr = make_recip_table(pE->aSeries[s].nLen, pE->aSeries[s].kk)))
+    {
+      memerr(MAX_SERIES + 1);
+    }
+#endif // HAS_RECIP
+  }
+
+  if(!MyCreateThread(pE))
+  {
+    printf("\nThe threaded sweep can't run here (one CPU or one series), nothing to tune\n");
+    free_series(pE);
+    return (1);
+  }
+
+  printf("\nSweep times, %d series, %d digits per sweep%s\n\n", pE->nSeries, (int)pE->nChunk, bRecip ? ", reciprocal tables" : "");
+  printf("  terms     single   threaded  (usecs per sweep)\n");
+
+  for(l = TUNE_MIN_LEN; l <= TUNE_MAX_LEN; l *= 2)
+  {
+    r = (int32_t)((l - 1) * pE->aSeries[0].dLog) - pE->nGuard; // the digits left when series 0 is 'l' long
+    series_lens(pE, r, aLen);
+
+    nReps = (int32_t)(TUNE_TERMS / aLen[0]) + 3;
+
+    sweep_all(pE, aLen, aVal); // in the cache, like the sweep before it would have left it
+    ullT0 = ns_clock();
+
+    for(i1 = 0; i1 < nReps; i1++)
+    {
+      sweep_all(pE, aLen, aVal);
+    }
+
+    ullSingle = (ns_clock() - ullT0) / nReps;
+
+    threaded_sweep(pE, aLen, aLen, aVal);
+    ullT0 = ns_clock();
+
+    for(i1 = 0; i1 < nReps; i1++)
+    {
+      threaded_sweep(pE, aLen, aLen, aVal);
+    }
+
+    ullThread = (ns_clock() - ullT0) / nReps;
+    threaded_sweep(pE, aLen, NULL, aVal); // nothing left done ahead
+
+    printf("  %6ld  %9.2f  %9.2f\n", (long)aLen[0], ullSingle / 1000.0, ullThread / 1000.0);
+
+    // the crossover is where the threads start winning for good
+    if(ullThread < ullSingle)
+    {
+      if(!bWins)
+      {
+        nBest = aLen[0];
+      }
+
+      bWins = 1;
+    }
+    else
+    {
+      bWins = 0;
+      nBest = INT32_MAX;
+    }
+  }
+
+  MyDestroyThread(pE);
+  free_series(pE);
+
+  if(nBest == INT32_MAX)
+  {
+    printf("\nThe threads never won, sweeps stay single threaded\n");
+  }
+  else
+  {
+    printf("\nThreaded sweeps from %ld terms (built in:  %d)\n", (long)nBest, USE_THREAD);
+  }
+
+  if(NULL == (pF = fopen(pName, "w")))
+  {
+    fprintf(stderr, "\nCan't create '%s'\n", pName);
+    return (1);
+  }
+
+  fprintf(pF, "# pi threading profile, written by 'pi --tune'\n");
+  fprintf(pF, "cpus %ld\n", (long)sysconf(_SC_NPROCESSORS_ONLN));
+  fprintf(pF, "thread_min %ld\n", (long)nBest);
+  fclose(pF);
+
+  printf("Saved in '%s'\n", pName);
+
+  return (0);
+#else  // USE_THREAD
+  (void)pName;
+  (void)bRecip;
+
+  printf("\nThis is a single thread build, nothing to tune\n");
+  return (1);
+#endif // USE_THREAD
+}
+
+// TELEMETRY, the reporting side.  'telem_start' maps the segment and starts the reporting
+// thread, 'telem_stop' has it report one last time, marks the segment finished, and
+// unlinks it.  A monitor that has it mapped keeps its mapping and sees the end, and nothing
+// is left behind in /dev/shm for a later monitor to mistake for a live run.  (one that was
+// killed does leave it, with 'bFinished' clear and a dead 'nPid', which the monitor checks)
+// It's all 'mmap' and POSIX threads, so WIN32 and the single thread build don't have it.
+
+int nTelemSecs;          // '-i', 0 for nothing on stderr
+const char *pTelemName;  // '-I', NULL for no segment
+int nTelemEngine;        // PI_SPIGOT or PI_CHUDNOVSKY
+PI_STATS *pTelemStats;   // the segment, mapped
+uint64_t ullTelemStart, ullTelemLast; // when the run started, when the last report was
+int32_t nTelemCnt0, nTelemLastCnt;    // 'cnt' then (a resumed run starts past 0)
+uint64_t aullTelemLast[PI_STATS_THREADS];
+PI_ENGINE *pTelemEngine; // the run it's reporting on
+
+#ifdef USE_THREAD
+pthread_t idTelemThread;
+pthread_mutex_t mtxTelem = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t condTelem = PTHREAD_COND_INITIALIZER;
+int bTelemThread, bTelemExit;
+#endif // USE_THREAD
+
+// the seconds left.  A spigot sweep with 'r' digits left to go costs about 'r', so the
+// rest of the run costs about r^2 / 2, and that's weighed against what the digits done
+// since the start cost.  The Chudnovsky engine has no digits until it's nearly done
+
+double telem_eta(double dElapsed)
+{
+double dLeft, dDone;
+
+  if(nTelemEngine != PI_SPIGOT || pTelemEngine->cnt <= nTelemCnt0)
+  {
+    return -1.0;
+  }
+
+  dLeft = (double)(pTelemEngine->n - pTelemEngine->cnt);
+  dDone = (double)(pTelemEngine->n - nTelemCnt0) * (double)(pTelemEngine->n - nTelemCnt0) - dLeft * dLeft;
+
+  return dDone > 0 ? dElapsed * dLeft * dLeft / dDone : -1.0;
+}
+
+void telem_report(int bFinal)
+{
+uint64_t ullNow = ns_clock(), ullSpan;
+uint64_t aullBusy[PI_STATS_THREADS];
+int32_t nDone = pTelemEngine->cnt, nLen = pTelemEngine->nTelemLen;
+int nThreads = nTelemThreads, i1;
+double dElapsed, dRate, dEta;
+unsigned int nEta;
+
+  ullSpan = ullNow - ullTelemLast;
+  dElapsed = (double)(ullNow - ullTelemStart) / 1e9;
+  dRate = ullSpan ? (double)(nDone - nTelemLastCnt) * 1e9 / (double)ullSpan : 0.0;
+  dEta = bFinal ? 0.0 : telem_eta(dElapsed);
+
+  for(i1 = 0; i1 < nThreads; i1++)
+  {
+    aullBusy[i1] = aTelemSlots[i1].ullBusyNs;
+  }
+
+  if(pTelemStats) // odd 'nSeq' while it changes, see pi.h
+  {
+    __atomic_store_n(&(pTelemStats->nSeq), pTelemStats->nSeq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    pTelemStats->nDone = nDone;
+    pTelemStats->nSweepLen = bFinal ? 0 : nLen;
+    pTelemStats->nThreads = nThreads;
+    pTelemStats->bFinished = bFinal;
+    pTelemStats->dElapsed = dElapsed;
+    pTelemStats->dDigitsPerSec = dRate;
+    pTelemStats->dEta = dEta;
+    memcpy(pTelemStats->aullBusyNs, aullBusy, nThreads * sizeof(uint64_t));
+
+    __atomic_store_n(&(pTelemStats->nSeq), pTelemStats->nSeq + 1, __ATOMIC_RELEASE);
+  }
+
+  if(nTelemSecs)
+  {
+    fprintf(stderr, "PROGRESS:  %ld of %ld digits (%.1f%%), %.0f digits/s",
+            (long)nDone, (long)pTelemEngine->n, pTelemEngine->n ? 100.0 * nDone / pTelemEngine->n : 100.0, dRate);
+
+    if(nLen && !bFinal)
+    {
+      fprintf(stderr, ", sweep %ld terms", (long)nLen);
+    }
+
+    if(nThreads && ullSpan) // how much of the interval each thread was busy
+    {
+      fprintf(stderr, ", busy");
+
+      for(i1 = 0; i1 < nThreads; i1++)
+      {
+        fprintf(stderr, " %d%%", (int)((aullBusy[i1] - aullTelemLast[i1]) * 100 / ullSpan));
+      }
+    }
+
+    if(dEta >= 0 && !bFinal)
+    {
+      nEta = (unsigned int)(dEta + 0.5);
+      fprintf(stderr, ", ETA %u:%02u:%02u", nEta / 3600, (nEta / 60) % 60, nEta % 60);
+    }
+
+    fprintf(stderr, "\n");
+  }
+
+  memcpy(aullTelemLast, aullBusy, nThreads * sizeof(uint64_t));
+  ullTelemLast = ullNow;
+  nTelemLastCnt = nDone;
+}
+
+#ifdef USE_THREAD
+void *telem_thread_proc(void *pArg)
+{
+struct timespec ts;
+int nSecs = nTelemSecs ? nTelemSecs : 1; // the segment alone is kept up to date every second
+
+  (void)pArg;
+
+  pthread_mutex_lock(&mtxTelem);
+
+  while(!bTelemExit)
+  {
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += nSecs;
+
+    while(!bTelemExit && pthread_cond_timedwait(&condTelem, &mtxTelem, &ts) == 0)
+    {
+    }
+
+    if(!bTelemExit)
+    {
+      telem_report(0);
+    }
+  }
+
+  pthread_mutex_unlock(&mtxTelem);
+
+  return NULL;
+}
+#endif // USE_THREAD
+
+// 'pE' is about to run 'nEngine'.  Returns zero if the segment couldn't be set up
+
+int telem_start(PI_ENGINE *pE, int nEngine)
+{
+#ifdef USE_THREAD
+int fd;
+
+  if(!nTelemSecs && !pTelemName)
+  {
+    return 1;
+  }
+
+  nTelemEngine = nEngine;
+  pTelemEngine = pE;
+  pE->nTelemLen = 0;
+  nTelemThreads = 0;
+  memset(aTelemSlots, 0, sizeof(aTelemSlots));
+  memset(aullTelemLast, 0, sizeof(aullTelemLast));
+  ullTelemStart = ullTelemLast = ns_clock();
+  nTelemCnt0 = nTelemLastCnt = pE->cnt;
+
+  if(pTelemName)
+  {
+    fd = shm_open(pTelemName, O_CREAT | O_RDWR, 0644);
+
+    if(fd < 0 || ftruncate(fd, sizeof(PI_STATS)) ||
+       MAP_FAILED == (pTelemStats = (PI_STATS *)mmap(NULL, sizeof(PI_STATS), PROT_READ | PROT_WRITE,
+                                                     MAP_SHARED, fd, 0)))
+    {
+      fprintf(stderr, "\nCan't set up the shared memory segment '%s'\n", pTelemName);
+
+      if(fd >= 0)
+      {
+        close(fd);
+      }
+
+      pTelemStats = NULL;
+      return 0;
+    }
+
+    close(fd);
+
+    memset(pTelemStats, 0, sizeof(PI_STATS));
+    pTelemStats->nPid = (int32_t)getpid();
+    pTelemStats->nEngine = nEngine;
+    pTelemStats->nDigits = pE->n;
+    pTelemStats->nDone = pE->cnt;
+    pTelemStats->dEta = -1.0;
+
+    __atomic_store_n(&(pTelemStats->nMagic), PI_STATS_MAGIC, __ATOMIC_RELEASE);
+  }
+
+  pE->bTelemetry = 1;
+  bTelemExit = 0;
+  bTelemThread = !pthread_create(&idTelemThread, NULL, telem_thread_proc, NULL);
+
+  if(!bTelemThread)
+  {
+    fprintf(stderr, "NOTE:  can't start the telemetry thread, no progress reports\n");
+  }
+#else  // USE_THREAD
+  (void)pE;
+  (void)nEngine;
+
+  if(nTelemSecs || pTelemName)
+  {
+    fprintf(stderr, "NOTE:  '-i' and '-I' need threads, this is a single thread build\n");
+  }
+#endif // USE_THREAD
+
+  return 1;
+}
+
+void telem_stop(void)
+{
+#ifdef USE_THREAD
+  if(bTelemThread)
+  {
+    pthread_mutex_lock(&mtxTelem);
+    bTelemExit = 1;
+    pthread_cond_signal(&condTelem);
+    pthread_mutex_unlock(&mtxTelem);
+
+    pthread_join(idTelemThread, NULL);
+    bTelemThread = 0;
+
+    telem_report(1);
+  }
+
+  if(pTelemStats)
+  {
+    munmap(pTelemStats, sizeof(PI_STATS));
+    pTelemStats = NULL;
+
+    shm_unlink(pTelemName);
+  }
+
+  if(pTelemEngine)
+  {
+    pTelemEngine->bTelemetry = 0;
+    pTelemEngine = NULL;
+  }
+#endif // USE_THREAD
+}
+
+// 'pi --monitor name [seconds]' - follows a run's segment from another process until the
+// run finishes (or goes away without finishing, which is a non-zero return)
+
+int telem_monitor(const char *pName, int nSecs)
+{
+#ifndef _WIN32
+PI_STATS *pS, st;
+uint32_t nSeq;
+int fd, i1;
+
+  fd = shm_open(pName, O_RDONLY, 0);
+
+  if(fd < 0 || MAP_FAILED == (pS = (PI_STATS *)mmap(NULL, sizeof(PI_STATS), PROT_READ, MAP_SHARED, fd, 0)))
+  {
+    fprintf(stderr, "\nCan't open the shared memory segment '%s'\n", pName);
+    return (1);
+  }
+
+  close(fd);
+
+  if(nSecs < 1)
+  {
+    nSecs = 1;
+  }
+
+  for(;;)
+  {
+    do // a copy from between two updates
+    {
+      while((nSeq = __atomic_load_n(&(pS->nSeq), __ATOMIC_ACQUIRE)) & 1)
+      {
+        usleep(1000);
+      }
+
+      memcpy(&st, pS, sizeof(st));
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while(__atomic_load_n(&(pS->nSeq), __ATOMIC_RELAXED) != nSeq);
+
+    if(st.nMagic != PI_STATS_MAGIC)
+    {
+      fprintf(stderr, "\n'%s' isn't a pi telemetry segment\n", pName);
+      munmap(pS, sizeof(PI_STATS));
+      return (1);
+    }
+
+    printf("pid %ld:  %ld of %ld digits, %.1f s, %.0f digits/s", (long)st.nPid, (long)st.nDone,
+           (long)st.nDigits, st.dElapsed, st.dDigitsPerSec);
+
+    if(st.nSweepLen)
+    {
+      printf(", sweep %ld", (long)st.nSweepLen);
+    }
+
+    for(i1 = 0; i1 < st.nThreads && i1 < PI_STATS_THREADS; i1++)
+    {
+      printf("%s%.2f", i1 ? " " : ", busy s ", (double)st.aullBusyNs[i1] / 1e9);
+    }
+
+    if(st.dEta >= 0 && !st.bFinished)
+    {
+      printf(", ETA %.0f s", st.dEta);
+    }
+
+    printf("\n");
+    fflush(stdout);
+
+    if(st.bFinished)
+    {
+      break;
+    }
+
+    if(kill((pid_t)st.nPid, 0)) // (a run by another user looks gone too)
+    {
+      fprintf(stderr, "\npid %ld is gone, the run didn't finish\n", (long)st.nPid);
+      munmap(pS, sizeof(PI_STATS));
+      return (1);
+    }
+
+    sleep(nSecs);
+  }
+
+  munmap(pS, sizeof(PI_STATS));
+  return (0);
+#else  // _WIN32
+  (void)pName;
+  (void)nSecs;
+
+  fprintf(stderr, "\nNo shared memory telemetry on WIN32\n");
+  return (1);
+#endif // _WIN32
+}
+
+// the spigot, every series swept once per 'nChunk' digits
+
+void spigot_run(PI_ENGINE *pE, int bRecip)
+{
+Size_T cbTerms;
+int i, s;
+int bResume = pfResume != NULL, bCkpt;
+uint64_t ullT0 = 0, ullT1 = 0, ullT2;
+
+  // each series only needs the terms for the digits it is used for (see 'series_len')
+  pE->nGuard = (int32_t)log10((double)(pE->n > 1 ? pE->n : 1)) + 3;
+  pE->nSweeps = 0;
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    pE->aSeries[s].nLen = series_len(pE, pE->n, pE->aSeries[s].dLog, INT32_MAX);
+  }
+
+#ifndef HAS_INT128
+  // without 128-bit intermediates the multiplier has to be small enough for the
+  // longest sweep of every series (see 'sweep_limit')
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    while(pE->nChunk > 1 && sweep_limit(INT64_MAX, pE->aSeries[s].kk, pE->lChunk) < pE->aSeries[s].nLen)
+    {
+      pE->nChunk--;
+      pE->lChunk /= 10;
+
+      fprintf(stderr, "NOTE:  '-k' reduced to %d for %ld digits\n", pE->nChunk, (long)pE->n);
+    }
+  }
+#endif // HAS_INT128
+
+  for(s = 0; s < pE->nSeries; s++)
+  {
+    if(NULL == (pE->aSeries[s].pa = (int64_t *) term_alloc((Size_T) (pE->aSeries[s].nLen + 3L) * sizeof(int64_t))))
+    {
+      memerr(1 + s);
+    }
+
+    pE->aSeries[s].acbKept[0] = (pE->aSeries[s].nLen + 3L) * sizeof(int64_t);
+  }
+  if(!bResume)
+  {
+    if(!pE->bOutQuiet)
+    {
+      printf("\nApproximation of PI to %ld digits\n", (long)pE->n);
+    }
+
+    pE->cnt = 0;
+  }
+
+#ifdef _WIN32
+
+  // WIN32 addition - reduce priority down to 'background' level
+  SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_NORMAL - 1);
+
+#endif  // _WIN32
+
+  if(bResume)
+  {
+    ckpt_load_terms(pE); // the header and the digits so far are already in the output
+  }
+  else
+  {
+    // term 'i' of c * atan(1/x) starts out as c or -c (see 'sweep_range' for what the terms
+    // mean), and the 3 in front of the decimal point comes off term 1 of series 0
+    for(s = 0; s < pE->nSeries; s++)
+    {
+      for(i = 1; i <= (int)pE->aSeries[s].nLen; i += 2)
+      {
+        pE->aSeries[s].pa[i] = pE->aSeries[s].c;
+        pE->aSeries[s].pa[i + 1] = -pE->aSeries[s].c;
+      }
+    }
+
+    pE->aSeries[0].pa[1] -= 3 * pE->aSeries[0].x;
+
+    for(s = 0; s < pE->nSeries; s++)
+    {
+      normalize_series(pE->aSeries[s].pa, pE->aSeries[s].nLen, pE->aSeries[s].kk);
+    }
+  }
+
+#ifdef HAS_RECIP
+  if(bRecip)
+  {
+    for(cbTerms = 0, s = 0; s < pE->nSeries; s++)
+    {
+      if(NULL == (pE->aSeries[s].pr = make_recip_table(pE->aSeries[s].nLen, pE->aSeries[s].kk)))
+      {
+        memerr(MAX_SERIES + 1);
+      }
+
+      pE->aSeries[s].acbKept[1] = (pE->aSeries[s].nLen + 3L) * sizeof(uint64_t);
+
+      cbTerms += (pE->aSeries[s].nLen + 3L) * sizeof(uint64_t);
+    }
+
+    // the cost of the tables, to weigh against the speedup
+    fprintf(stderr, "NOTE:  reciprocal tables use %lu bytes (the terms use as much)\n",
+            (unsigned long)cbTerms);
+  }
+#endif // HAS_RECIP
+
+  if(!pE->bOutPacked && !pE->bOutQuiet && !bResume)
+  {
+    printf("\n 3.");
+  }
+
+  if(pE->nTileThreads && !bResume)
+  {
+    ullT0 = bPhaseTimes ? ns_clock() : 0;
+    tile_run(pE); // the long sweeps
+
+    if(bPhaseTimes) // its digits are combined as it goes, it all counts as sweeping
+    {
+      aullPhaseNs[PH_SWEEP] += ns_clock() - ullT0;
+    }
+  }
+
+  pE->dwCkptTick = ckpt_tick();
+
+  while(pE->cnt < pE->n)
+  {
+    int64_t aVal[MAX_SERIES];
+    int32_t aLen[MAX_SERIES];
+    int32_t r;
+
+    r = pE->n - pE->nSweeps * pE->nChunk; // digits left to produce
+    pE->nSweeps++;
+
+    pE->nd = 0;
+    bCkpt = 0;
+
+    if(bPhaseTimes)
+    {
+      ullT0 = ns_clock();
+    }
+
+    if(r > -pE->nGuard) // past that the terms are all guard digits, just flush 'stor[]'
+    {
+      series_lens(pE, r, aLen);
+      trim_series(pE, aLen);
+
+      pE->nTelemLen = aLen[0];
+
+      bCkpt = pE->nCkptSecs && ckpt_tick() - pE->dwCkptTick >= (unsigned int)pE->nCkptSecs * 1000U;
+
+#ifdef USE_THREAD
+      if(aLen[0] >= nThreadMin && MyCreateThread(pE))
+      {
+        int32_t aLen1[MAX_SERIES];
+        int bNext = 0;
+
+        if(r - pE->nChunk > -pE->nGuard && !bCkpt) // the next sweep, if it uses the workers too
+        {
+          series_lens(pE, r - pE->nChunk, aLen1);
+          bNext = aLen1[0] >= nThreadMin;
+        }
+
+        threaded_sweep(pE, aLen, bNext ? aLen1 : NULL, aVal);
+      }
+      else
+#endif // USE_THREAD
+      {
+        ullT2 = pE->bTelemetry ? ns_clock() : 0;
+        sweep_all(pE, aLen, aVal);
+
+        if(pE->bTelemetry)
+        {
+          telem_busy(0, ullT2);
+        }
+      }
+
+      if(bPhaseTimes)
+      {
+        ullT1 = ns_clock();
+        aullPhaseNs[PH_SWEEP] += ullT1 - ullT0;
+        ullT0 = ullT1;
+      }
+
+      for(s = 0; s < pE->nSeries; s++)
+      {
+        shift1(&(pE->nd), pE->aSeries[s].pa + 1, aVal[s], pE->aSeries[s].x);
+      }
+    }
+
+    xprint(pE, pE->nd);
+
+    if(bPhaseTimes)
+    {
+      aullPhaseNs[PH_COMBINE] += ns_clock() - ullT0;
+    }
+
+    if(bCkpt)
+    {
+      ckpt_save(pE, aLen);
+    }
+  }
+
+#ifdef USE_THREAD
+  MyDestroyThread(pE);
+#endif // USE_THREAD
+
+  ckpt_done(pE);
+}
+
+
+// LIBRARY ('PI_LIBRARY', see pi.h) - the same engines behind a create/run/destroy
+// interface, with the digits going to a callback instead of stdout.  Everything a run
+// changes is in its engine (see 'ENGINE STATE'), so engines on different threads run at
+// the same time, each with its own workers.  Running out of memory doesn't print or exit,
+// the run fails and 'pi_engine_run' returns 2 (see 'run_fail').
+
+// sets 'pE' up for a new run of 'nDigits' digits, 'nPerSweep' at a time ('-k', 0 for 1)
+// and 'nTile' wavefront threads ('-t'), the way 'main' does before it reads the options
+
+void run_reset(PI_ENGINE *pE, int32_t nDigits, int nPerSweep, int nTile)
+{
+int i1;
+
+  pE->cnt = 0;
+  pE->nd = 0;
+  pE->n = nDigits;
+  pE->col = pE->col1 = 0;
+  pE->loc = 0;
+  memset(pE->stor, 0, sizeof(pE->stor));
+
+  pE->nChunk = nPerSweep ? nPerSweep : 1;
+  for(pE->lChunk = 10, i1 = 1; i1 < pE->nChunk; i1++)
+  {
+    pE->lChunk *= 10;
+  }
+
+  pE->nTileThreads = nTile;
+  pE->nTileBlock = DEFAULT_TILE_BLOCK;
+  pE->nTileDepth = DEFAULT_TILE_DEPTH;
+#ifndef USE_THREAD
+  pE->nTileThreads = pE->nTileThreads ? 1 : 0;
+#endif // USE_THREAD
+  pE->nCkptSecs = 0;
+
+  // and whatever the last run (or '--bench') may have left set
+  pE->nSweeps = 0;
+  pE->nRunErr = 0;
+  pE->nTelemLen = 0;
+  pE->bTelemetry = 0;
+  pE->nChudMaxThreads = 0;
+#ifdef USE_THREAD
+  pE->bNoWorker = 0;
+  pE->nLagSplit = 0;
+#endif // USE_THREAD
+}
+
+PI_ENGINE *pi_engine_create(int32_t nDigits, const PI_OPTIONS *pOpts)
+{
+PI_ENGINE *pE;
+
+  if(nDigits < 1 ||
+     (pOpts && (pOpts->nDigitsPerSweep < 0 || pOpts->nDigitsPerSweep > MAX_CHUNK ||
+                pOpts->nTileThreads < 0 || (pOpts->nEngine != PI_SPIGOT && pOpts->nEngine != PI_CHUDNOVSKY) ||
+                (pOpts->pFormula && strlen(pOpts->pFormula) >= MAX_SERIES * 48))))
+  {
+    return NULL;
+  }
+
+  if(NULL == (pE = (PI_ENGINE *)calloc(1, sizeof(PI_ENGINE))))
+  {
+    return NULL;
+  }
+
+  pE->nDigits = nDigits;
+
+  if(pOpts)
+  {
+    pE->opts = *pOpts;
+  }
+
+  strcpy(pE->szFormula, pE->opts.pFormula ? pE->opts.pFormula : "machin");
+  pE->opts.pFormula = pE->szFormula;
+
+  run_reset(pE, nDigits, pE->opts.nDigitsPerSweep, pE->opts.nTileThreads);
+
+  return pE;
+}
+
+int pi_engine_run(PI_ENGINE *pE, PI_DIGITS_CB pfnDigits, void *pUser)
+{
+PI_ENGINE *volatile pPrev = pRunEngine; // 'setjmp'
+volatile int nRet = 0;
+int i1;
+
+  if(!pE || !pfnDigits)
+  {
+    return (1);
+  }
+
+  pRunEngine = pE; // for 'memerr'
+
+  run_reset(pE, pE->nDigits, pE->opts.nDigitsPerSweep, pE->opts.nTileThreads);
+
+  pE->pfnOutDigits = pfnDigits;
+  pE->pOutUser = pUser;
+  pE->bOutQuiet = 1;
+
+  if(setjmp(pE->jbRun)) // 'run_fail', every helper thread is gone by now
+  {
+    pE->cbOut = 0; // the digits in the block being filled don't go out
+
+    if(pE->pOut)
+    {
+      out_close(pE);
+    }
+
+    for(i1 = 0; i1 < OUT_RING; i1++) // if 'out_open' itself failed
+    {
+      if(pE->apOutRing[i1])
+      {
+        Ffree(pE->apOutRing[i1]);
+        pE->apOutRing[i1] = NULL;
+      }
+    }
+
+#ifdef USE_THREAD
+    MyDestroyThread(pE);
+#endif // USE_THREAD
+    free_series(pE);
+
+    nRet = 2;
+  }
+  else if(!set_formula(pE, pE->opts.pFormula) || !out_open(pE, NULL, -1, -1))
+  {
+    nRet = 1;
+  }
+  else
+  {
+    if(pE->opts.nEngine == PI_CHUDNOVSKY)
+    {
+      chud_run(pE);
+    }
+    else
+    {
+#ifdef HAS_RECIP
+      spigot_run(pE, pE->opts.bRecip);
+#else  // HAS_RECIP
+      spigot_run(pE, 0);
+#endif // HAS_RECIP
+    }
+
+    out_close(pE);
+    free_series(pE);
+  }
+
+  pE->pfnOutDigits = NULL;
+  pE->pOutUser = NULL;
+  pE->bOutQuiet = 0;
+
+  pRunEngine = pPrev;
+
+  return nRet;
+}
+
+void pi_engine_destroy(PI_ENGINE *pE)
+{
+  free(pE);
+}
+
+
+// BENCHMARK ('--bench') - runs every configuration in 'aBench' at 1,000 digits and up by
+// tens to 'nMax' (a million by default, the spigot stops at BENCH_SPIGOT_MAX because it's
+// O(n^2)), and prints one record per run as CSV or JSON on stdout:  the total time and
+// the phase times (see 'PH_SWEEP'), in nanoseconds, and digits per second.  The digits
+// go through the usual output layout into the null device, so the output phase is the
+// real writer, less the disk.  Keep the records from two builds and compare them.
+
+#define BENCH_SPIGOT_MAX 100000L
+
+typedef struct _BENCH_CONFIG_
+{
+  const char *pName;
+  int bChud;      // the Chudnovsky engine, otherwise the spigot
+  int nPerSweep;  // '-k'
+  int bRecip;     // '-r'
+  int bThreads;   // use the threads (per-series workers, or the Chudnovsky tree and NTT)
+  int bTile;      // the wavefront engine with a thread per CPU
+} BENCH_CONFIG;
+
+BENCH_CONFIG aBench[] =
+{
+  { "spigot",          0, 1, 0, 0, 0 },
+  { "spigot-threads",  0, 1, 0, 1, 0 },
+  { "spigot-k9-r",     0, 9, 1, 1, 0 },
+  { "wavefront-k9-r",  0, 9, 1, 1, 1 },
+  { "chudnovsky-1",    1, 0, 0, 0, 0 },
+  { "chudnovsky",      1, 0, 0, 1, 0 },
+};
+
+// returns the exit code
+
+int bench_run(const char *pFormat, int32_t nMax)
+{
+static const char *apPhase[PH_COUNT] = { "sweep_ns", "combine_ns", "output_ns" };
+BENCH_CONFIG *pC;
+PI_ENGINE *pE;
+FILE *pfNull;
+uint64_t ullTotal;
+int32_t nDigits;
+int nCpus = 1, nThreads, bJson, bFirst = 1, i1, i2;
+
+  bJson = !strcmp(pFormat, "json");
+
+  if(!bJson && strcmp(pFormat, "csv"))
+  {
+    fprintf(stderr, "\n'--bench' output is 'csv' or 'json'\n");
+    return (1);
+  }
+
+#ifdef _WIN32
+  pfNull = fopen("NUL", "wb");
+#else  // _WIN32
+  pfNull = fopen("/dev/null", "wb");
+#endif // _WIN32
+  if(!pfNull)
+  {
+    fprintf(stderr, "\nCan't open the null device\n");
+    return (1);
+  }
+
+  if(NULL == (pE = pi_engine_create(1, NULL)))
+  {
+    memerr(MAX_SERIES + 5);
+  }
+
+  pRunEngine = pE;
+
+#ifdef USE_THREAD
+  nCpus = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  nCpus = nCpus > 0 ? nCpus : 1;
+#endif // USE_THREAD
+
+  if(bJson)
+  {
+    printf("{\n  \"cpus\": %d,\n  \"runs\": [\n", nCpus);
+  }
+  else
+  {
+    printf("config,engine,digits,threads,total_ns,%s,%s,%s,digits_per_sec\n", apPhase[0], apPhase[1], apPhase[2]);
+  }
+
+  pE->bOutQuiet = 1;
+  bPhaseTimes = 1;
+
+  for(i1 = 0; i1 < (int)(sizeof(aBench) / sizeof(aBench[0])); i1++)
+  {
+    pC = aBench + i1;
+
+    for(nDigits = 1000; nDigits <= nMax && (pC->bChud || nDigits <= BENCH_SPIGOT_MAX); nDigits *= 10)
+    {
+      fprintf(stderr, "%s, %ld digits\n", pC->pName, (long)nDigits);
+
+      run_reset(pE, nDigits, pC->nPerSweep, pC->bTile ? nCpus : 0);
+      set_formula(pE, "machin");
+
+      // the threads to use, and the threads it's reported with
+      nThreads = pC->bThreads ? (pC->bChud ? nCpus : pE->nSeries < nCpus ? pE->nSeries : nCpus) : 1;
+      nThreads = pC->bTile ? nCpus : nThreads;
+      pE->nChudMaxThreads = pC->bThreads ? 0 : 1;
+#ifdef USE_THREAD
+      pE->bNoWorker = !pC->bThreads || nCpus < 2;
+#endif // USE_THREAD
+
+      memset(aullPhaseNs, 0, sizeof(aullPhaseNs));
+      ullTotal = ns_clock();
+
+      out_open(pE, NULL, -1, -1);
+      pE->pfOut = pfNull; // before the first block, so everything goes there
+
+      if(pC->bChud)
+      {
+        chud_run(pE);
+      }
+      else
+      {
+        spigot_run(pE, pC->bRecip);
+      }
+
+      out_close(pE);
+      free_series(pE);
+
+      ullTotal = ns_clock() - ullTotal;
+
+      if(bJson)
+      {
+        printf("%s    { \"config\": \"%s\", \"engine\": \"%s\", \"digits\": %ld, \"threads\": %d, \"total_ns\": %llu",
+               bFirst ? "" : ",\n", pC->pName, pC->bChud ? "chudnovsky" : "spigot", (long)nDigits, nThreads,
+               (unsigned long long)ullTotal);
+
+        for(i2 = 0; i2 < PH_COUNT; i2++)
+        {
+          printf(", \"%s\": %llu", apPhase[i2], (unsigned long long)aullPhaseNs[i2]);
+        }
+
+        printf(", \"digits_per_sec\": %.0f }", nDigits * 1e9 / (double)(ullTotal ? ullTotal : 1));
+      }
+      else
+      {
+        printf("%s,%s,%ld,%d,%llu", pC->pName, pC->bChud ? "chudnovsky" : "spigot", (long)nDigits, nThreads,
+               (unsigned long long)ullTotal);
+
+        for(i2 = 0; i2 < PH_COUNT; i2++)
+        {
+          printf(",%llu", (unsigned long long)aullPhaseNs[i2]);
+        }
+
+        printf(",%.0f\n", nDigits * 1e9 / (double)(ullTotal ? ullTotal : 1));
+      }
+
+      fflush(stdout);
+      bFirst = 0;
+    }
+  }
+
+  if(bJson)
+  {
+    printf("\n  ]\n}\n");
+  }
+
+  bPhaseTimes = 0;
+  pRunEngine = NULL;
+  pi_engine_destroy(pE);
+  fclose(pfNull);
+
+  return (0);
+}
+
+// DIGIT STORE ('--store' and '--query') - an n digit run has every shorter one in it, so
+// keep the digits instead of computing them again.  A store is a STORE_HEADER and then
+// the digits after the '3.' packed the way '-o' packs them (2 to a byte, high nibble
+// first, 0xF after an odd last digit), so digit 'k' is in byte (k - 1) / 2 of the data
+// and a query maps the file and goes straight there.  A plain '-o' file (no header) can
+// be queried too.
+//
+// Asking a store for more digits than it has runs the engine for the new total and only
+// the new digits get written, on the end.  The ones it already had are compared on the
+// way past instead.  The header's count goes up after the digits are on the disk, so a
+// store that was cut short still has the count it had before.
+
+#define STORE_MAGIC "PISTOR01"
+#define STORE_QUERY_DIGITS 50 /* digits a query prints if it's not told */
+
+typedef struct _STORE_HEADER_
+{
+  char szMagic[8];
+  int64_t llDigits;  // digits after the '3.' in the store
+  int32_t nEngine;   // PI_SPIGOT or PI_CHUDNOVSKY, whatever computed the last of them
+  char reserved[44]; // the digits start 64 bytes in
+} STORE_HEADER;
+
+typedef struct _STORE_RUN_
+{
+  FILE *pF;            // the store
+  const uint8_t *pOld; // the digits it had ('store_map'), NULL if none
+  int64_t llHave;      // and how many
+  int64_t llBad;       // old digits the new run disagreed with
+  uint8_t *pBuf;       // packed new digits waiting to be written
+  int32_t cbBuf;
+  int bOdd;            // the last byte of 'pBuf' only has its high digit
+} STORE_RUN;
+
+// maps a whole file read-only, NULL if it can't (or it's empty).  The WIN32 build reads
+// it all in instead
+
+void *file_map(const char *pName, Size_T *pcb)
+{
+void *pBase;
+#ifndef _WIN32
+int fd;
+struct stat st;
+
+  if((fd = open(pName, O_RDONLY)) < 0)
+  {
+    return NULL;
+  }
+
+  if(fstat(fd, &st) || !st.st_size ||
+     MAP_FAILED == (pBase = mmap(NULL, (Size_T)st.st_size, PROT_READ, MAP_SHARED, fd, 0)))
+  {
+    close(fd);
+    return NULL;
+  }
+
+  close(fd);
+  *pcb = (Size_T)st.st_size;
+#else  // _WIN32
+FILE *pF;
+Size_T cb;
+
+  if(NULL == (pF = fopen(pName, "rb")))
+  {
+    return NULL;
+  }
+
+  fseek(pF, 0L, SEEK_END);
+  cb = (Size_T)ftell(pF);
+  fseek(pF, 0L, SEEK_SET);
+
+  if(!cb || NULL == (pBase = Fcalloc(cb, (Size_T)1)) || fread(pBase, 1, cb, pF) != cb)
+  {
+    Ffree(pBase);
+    fclose(pF);
+    return NULL;
+  }
+
+  fclose(pF);
+  *pcb = cb;
+#endif // _WIN32
+
+  return pBase;
+}
+
+void file_unmap(void *pBase, Size_T cb)
+{
+  if(pBase)
+  {
+#ifndef _WIN32
+    munmap(pBase, cb);
+#else  // _WIN32
+    (void)cb;
+    Ffree(pBase);
+#endif // _WIN32
+  }
+}
+
+// the digits of a '-o' file or a store ('file_map'ped at '*ppBase', '*pcb' bytes).
+// '*pllDigits' is how many there are, 'pH' gets the header (zeroed for a '-o' file)
+
+const uint8_t *store_map(const char *pName, STORE_HEADER *pH, int64_t *pllDigits, void **ppBase, Size_T *pcb)
+{
+uint8_t *pBase;
+Size_T cb = 0;
+
+  memset(pH, 0, sizeof(*pH));
+  *ppBase = pBase = (uint8_t *)file_map(pName, &cb);
+  *pcb = cb;
+
+  if(!pBase)
+  {
+    return NULL;
+  }
+
+  if(cb >= sizeof(STORE_HEADER) && !memcmp(pBase, STORE_MAGIC, sizeof(pH->szMagic)))
+  {
+    memcpy(pH, pBase, sizeof(*pH));
+
+    if(pH->llDigits < 0 || (Size_T)((pH->llDigits + 1) / 2) > cb - sizeof(STORE_HEADER))
+    {
+      pH->llDigits = (int64_t)(cb - sizeof(STORE_HEADER)) * 2; // cut short, take what's there
+    }
+
+    *pllDigits = pH->llDigits;
+    return pBase + sizeof(STORE_HEADER);
+  }
+
+  *pllDigits = (int64_t)cb * 2 - ((pBase[cb - 1] & 0x0f) == 0x0f); // a '-o' file
+  return pBase;
+}
+
+// digit 'k' (1 is the first after the point) of packed digits
+
+int store_digit(const uint8_t *p, int64_t k)
+{
+  return (k & 1) ? p[(k - 1) >> 1] >> 4 : p[(k - 1) >> 1] & 0x0f;
+}
+
+// the engine's callback for '--store'
+
+void store_digits(void *pUser, const char *pDigits, int32_t nDigits, int32_t nFirst)
+{
+STORE_RUN *pR = (STORE_RUN *)pUser;
+int64_t k = nFirst;
+int32_t i1;
+int m;
+
+  for(i1 = 0; i1 < nDigits; i1++, k++)
+  {
+    m = pDigits[i1] - '0';
+
+    if(k <= pR->llHave)
+    {
+      pR->llBad += store_digit(pR->pOld, k) != m;
+      continue;
+    }
+
+    if(pR->bOdd)
+    {
+      pR->pBuf[pR->cbBuf - 1] = (uint8_t)((pR->pBuf[pR->cbBuf - 1] & 0xf0) | m);
+    }
+    else
+    {
+      if(pR->cbBuf == OUT_BLOCK)
+      {
+        fwrite(pR->pBuf, 1, pR->cbBuf, pR->pF);
+        pR->cbBuf = 0;
+      }
+
+      pR->pBuf[pR->cbBuf++] = (uint8_t)((m << 4) | 0x0f);
+    }
+
+    pR->bOdd = !pR->bOdd;
+  }
+}
+
+// makes sure the store 'pName' has at least 'nDigits', running the engine in 'pOpts' for
+// them if it doesn't.  Returns the exit code
+
+int store_extend(const char *pName, int32_t nDigits, const PI_OPTIONS *pOpts)
+{
+STORE_HEADER h;
+STORE_RUN r;
+PI_ENGINE *pE;
+void *pBase;
+Size_T cbMap;
+int nRet;
+
+  memset(&r, 0, sizeof(r));
+  r.pOld = store_map(pName, &h, &r.llHave, &pBase, &cbMap);
+
+  if(r.pOld && memcmp(h.szMagic, STORE_MAGIC, sizeof(h.szMagic)))
+  {
+    fprintf(stderr, "\n'%s' isn't a digit store\n", pName);
+    file_unmap(pBase, cbMap);
+    return (1);
+  }
+
+  if(r.llHave >= nDigits)
+  {
+    printf("'%s' already has %lld digits\n", pName, (long long)r.llHave);
+    file_unmap(pBase, cbMap);
+    return (0);
+  }
+
+  if(NULL == (r.pF = fopen(pName, r.pOld ? "r+b" : "w+b")) ||
+     NULL == (r.pBuf = (uint8_t *)Fcalloc((Size_T)OUT_BLOCK, (Size_T)1)))
+  {
+    fprintf(stderr, "\nCan't open '%s'\n", pName);
+    file_unmap(pBase, cbMap);
+    return (1);
+  }
+
+  if(!r.pOld) // a new one, the header says 0 digits until there are some
+  {
+    memset(&h, 0, sizeof(h));
+    memcpy(h.szMagic, STORE_MAGIC, sizeof(h.szMagic));
+    fwrite(&h, sizeof(h), 1, r.pF);
+  }
+
+  // the new digits go after the old ones, and an odd last one shares its byte
+  fseek(r.pF, (long)(sizeof(STORE_HEADER) + r.llHave / 2), SEEK_SET);
+
+  if(r.llHave & 1)
+  {
+    r.pBuf[r.cbBuf++] = (uint8_t)(store_digit(r.pOld, r.llHave) << 4 | 0x0f);
+    r.bOdd = 1;
+  }
+
+  fprintf(stderr, "'%s':  %lld digits, computing %ld\n", pName, (long long)r.llHave, (long)nDigits);
+
+  nRet = 1;
+
+  if(NULL != (pE = pi_engine_create(nDigits, pOpts)))
+  {
+    nRet = pi_engine_run(pE, store_digits, &r);
+    pi_engine_destroy(pE);
+  }
+
+  if(!nRet && r.llBad)
+  {
+    fprintf(stderr, "\n%lld of the %lld digits already in '%s' don't match, it's left alone\n",
+            (long long)r.llBad, (long long)r.llHave, pName);
+    nRet = 1;
+  }
+
+  if(!nRet && r.cbBuf)
+  {
+    nRet = fwrite(r.pBuf, 1, r.cbBuf, r.pF) != (size_t)r.cbBuf;
+  }
+
+  if(!nRet && !fflush(r.pF)) // the digits are down, now the count
+  {
+    h.llDigits = nDigits;
+    h.nEngine = pOpts->nEngine;
+
+    fseek(r.pF, 0L, SEEK_SET);
+    nRet = fwrite(&h, sizeof(h), 1, r.pF) != 1;
+  }
+
+  nRet |= fclose(r.pF) != 0;
+  Ffree(r.pBuf);
+  file_unmap(pBase, cbMap);
+
+  if(nRet)
+  {
+    fprintf(stderr, "\n'%s' wasn't extended\n", pName);
+    return (1);
+  }
+
+  printf("'%s' has %ld digits\n", pName, (long)nDigits);
+  return (0);
+}
+
+// prints 'nCount' digits starting at digit 'llFirst' (1 is the first after the point)
+
+int store_query(const char *pName, int64_t llFirst, int64_t nCount)
+{
+STORE_HEADER h;
+const uint8_t *pDigits;
+int64_t llHave, k;
+void *pBase;
+Size_T cbMap;
+char *pLine;
+int32_t cb;
+
+  if(NULL == (pDigits = store_map(pName, &h, &llHave, &pBase, &cbMap)))
+  {
+    fprintf(stderr, "\nCan't read '%s'\n", pName);
+    return (1);
+  }
+
+  if(llFirst < 1 || nCount < 1 || llFirst + nCount - 1 > llHave)
+  {
+    fprintf(stderr, "\n'%s' has digits 1 through %lld\n", pName, (long long)llHave);
+    file_unmap(pBase, cbMap);
+    return (1);
+  }
+
+  if(NULL == (pLine = (char *)Fcalloc((Size_T)OUT_BLOCK, (Size_T)1)))
+  {
+    memerr(MAX_SERIES + 4);
+  }
+
+  for(k = llFirst, cb = 0; k < llFirst + nCount; k++)
+  {
+    pLine[cb++] = (char)('0' + store_digit(pDigits, k));
+
+    if(cb == OUT_BLOCK)
+    {
+      fwrite(pLine, 1, cb, stdout);
+      cb = 0;
+    }
+  }
+
+  fwrite(pLine, 1, cb, stdout);
+  printf("\n");
+
+  Ffree(pLine);
+  file_unmap(pBase, cbMap);
+
+  return (0);
+}
+
+// DIGIT SEARCH ('--search' and '--index') - finds a string of digits in a store (or a
+// '-o' file) and prints where it is.  Without an index the digits are unpacked a block at
+// a time and scanned 16 at a time with SSE2:  a position is only looked at closely if its
+// first AND its last digit match the pattern's, which rules out nearly all of them in two
+// compares.  '--index' builds 'file.idx' for repeated searches, every position of every
+// k digit string (a k-mer, INDEX_K digits by default) bucketed by the k-mer's value and
+// in order within the bucket.  A search looks up the rarest k-mer in the pattern and
+// checks just those positions, a couple of hundred in 100 million digits instead of a
+// scan.  An index built for a store with fewer digits isn't used, build it again.
+
+#define SEARCH_BLOCK (1L << 20)    /* digits unpacked at a time */
+#define SEARCH_MAX_PATTERN 4096
+#define SEARCH_SHOW 10             /* positions printed if it's not told */
+#define SEARCH_MAX_SHOW 1000
+#define INDEX_MAGIC "PIIDX001"
+#define INDEX_K 6
+#define INDEX_MAX_K 8
+
+typedef struct _INDEX_HEADER_
+{
+  char szMagic[8];
+  int64_t llDigits; // the store's digits when it was built
+  int32_t k;        // digits per k-mer
+  int32_t nPad;
+} INDEX_HEADER;     // then 10^k + 1 int64_t bucket starts, then the uint32_t positions
+
+typedef struct _SEARCH_HITS_
+{
+  int64_t llCount;                   // how many there are
+  int64_t allPos[SEARCH_MAX_SHOW];   // the first ones, in order
+  int nShow, nKept;                  // how many of them to keep, and how many are kept
+} SEARCH_HITS;
+
+// digits 'llFirst' through 'llFirst + nCount - 1' of packed digits, one to a byte (0 - 9)
+
+void store_unpack(const uint8_t *p, int64_t llFirst, int32_t nCount, uint8_t *pOut)
+{
+const uint8_t *pIn = p + ((llFirst - 1) >> 1);
+int32_t i1 = 0;
+
+  if(!(llFirst & 1) && nCount > 0) // starts on a low nibble
+  {
+    pOut[i1++] = *pIn++ & 0x0f;
+  }
+
+  for(; i1 + 1 < nCount; i1 += 2, pIn++)
+  {
+    pOut[i1] = *pIn >> 4;
+    pOut[i1 + 1] = *pIn & 0x0f;
+  }
+
+  if(i1 < nCount)
+  {
+    pOut[i1] = *pIn >> 4;
+  }
+}
+
+void search_hit(SEARCH_HITS *pH, int64_t llPos)
+{
+int i1;
+
+  pH->llCount++;
+
+  if(pH->nKept == pH->nShow && (!pH->nShow || llPos >= pH->allPos[pH->nKept - 1]))
+  {
+    return; // the usual case, they mostly come in order
+  }
+
+  if(pH->nKept < pH->nShow)
+  {
+    pH->nKept++;
+  }
+
+  for(i1 = pH->nKept - 1; i1 > 0 && pH->allPos[i1 - 1] > llPos; i1--)
+  {
+    pH->allPos[i1] = pH->allPos[i1 - 1];
+  }
+
+  pH->allPos[i1] = llPos;
+}
+
+// every place 'pPat' (digits 0 - 9) starts in the 'cb' unpacked digits 'pBuf', the first
+// of which is digit 'llBase'
+
+void search_scan(const uint8_t *pBuf, int32_t cb, const uint8_t *pPat, int32_t nPat, int64_t llBase,
+                 SEARCH_HITS *pH)
+{
+int32_t i = 0, nLast = cb - nPat; // the last place it could start
+#ifdef __SSE2__
+int32_t j;
+__m128i vFirst = _mm_set1_epi8((char)pPat[0]);
+__m128i vLast = _mm_set1_epi8((char)pPat[nPat - 1]);
+unsigned int wMask;
+
+  for(; i + 15 <= nLast; i += 16)
+  {
+    wMask = (unsigned int)_mm_movemask_epi8(
+              _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(pBuf + i)), vFirst),
+                            _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(pBuf + i + nPat - 1)), vLast)));
+
+    while(wMask)
+    {
+      j = i + __builtin_ctz(wMask);
+
+      if(nPat <= 2 || !memcmp(pBuf + j + 1, pPat + 1, nPat - 2))
+      {
+        search_hit(pH, llBase + j);
+      }
+
+      wMask &= wMask - 1;
+    }
+  }
+#endif // __SSE2__
+
+  for(; i <= nLast; i++)
+  {
+    if(pBuf[i] == pPat[0] && !memcmp(pBuf + i + 1, pPat + 1, nPat - 1))
+    {
+      search_hit(pH, llBase + i);
+    }
+  }
+}
+
+// scans all 'llHave' packed digits
+
+void search_store(const uint8_t *pDigits, int64_t llHave, const uint8_t *pPat, int32_t nPat, SEARCH_HITS *pH)
+{
+uint8_t *pBuf;
+int64_t k;
+int32_t nKeep = 0, nNew;
+
+  if(NULL == (pBuf = (uint8_t *)Fcalloc((Size_T)(SEARCH_BLOCK + SEARCH_MAX_PATTERN), (Size_T)1)))
+  {
+    memerr(MAX_SERIES + 4);
+  }
+
+  for(k = 1; k <= llHave; k += nNew)
+  {
+    nNew = llHave - k + 1 < SEARCH_BLOCK ? (int32_t)(llHave - k + 1) : (int32_t)SEARCH_BLOCK;
+    store_unpack(pDigits, k, nNew, pBuf + nKeep);
+
+    search_scan(pBuf, nKeep + nNew, pPat, nPat, k - nKeep, pH);
+
+    // the end of this block goes in front of the next one, for the matches across the two
+    nNew += nKeep;
+    nKeep = nPat - 1 < nNew ? nPat - 1 : nNew;
+    memmove(pBuf, pBuf + nNew - nKeep, nKeep);
+    nNew -= nKeep; // (just what's new goes on 'k')
+  }
+
+  Ffree(pBuf);
+}
+
+// adds up the k-mers ('pNext' is NULL) or puts their positions in place
+
+void index_pass(const uint8_t *pDigits, int64_t llHave, int32_t k, int32_t nBuckets, int64_t *pStart,
+                int64_t *pNext, uint32_t *pPos)
+{
+uint8_t *pBuf;
+int64_t llBlock, llPos;
+int32_t nNew, i1, v = 0;
+
+  if(NULL == (pBuf = (uint8_t *)Fcalloc((Size_T)SEARCH_BLOCK, (Size_T)1)))
+  {
+    memerr(MAX_SERIES + 4);
+  }
+
+  for(llBlock = 1; llBlock <= llHave; llBlock += nNew)
+  {
+    nNew = llHave - llBlock + 1 < SEARCH_BLOCK ? (int32_t)(llHave - llBlock + 1) : (int32_t)SEARCH_BLOCK;
+    store_unpack(pDigits, llBlock, nNew, pBuf);
+
+    for(i1 = 0; i1 < nNew; i1++)
+    {
+      v = (int32_t)(((int64_t)v * 10 + pBuf[i1]) % nBuckets); // the last k digits
+      llPos = llBlock + i1 - k + 1;                            // and where they start
+
+      if(llPos >= 1)
+      {
+        if(pNext)
+        {
+          pPos[pNext[v]++] = (uint32_t)llPos;
         }
+        else
+        {
+          pStart[v + 1]++;
+        }
+      }
+    }
+  }
+
+  Ffree(pBuf);
+}
+
+// builds 'pName.idx'.  Returns the exit code
+
+int index_build(const char *pName, int32_t k)
+{
+STORE_HEADER h;
+INDEX_HEADER ih;
+const uint8_t *pDigits;
+int64_t llHave, *pStart, *pNext;
+uint32_t *pPos;
+void *pBase;
+Size_T cbMap;
+char szIdx[FILENAME_MAX];
+FILE *pF;
+int32_t nBuckets, i1;
+uint64_t ullT0 = ns_clock();
+int nRet;
+
+  if(k < 1 || k > INDEX_MAX_K)
+  {
+    fprintf(stderr, "\nthe k-mers can be 1 to %d digits\n", INDEX_MAX_K);
+    return (1);
+  }
+
+  if(NULL == (pDigits = store_map(pName, &h, &llHave, &pBase, &cbMap)))
+  {
+    fprintf(stderr, "\nCan't read '%s'\n", pName);
+    return (1);
+  }
+
+  if(llHave < k || llHave > (int64_t)UINT32_MAX)
+  {
+    fprintf(stderr, "\n'%s' has %lld digits, too %s to index\n", pName, (long long)llHave,
+            llHave < k ? "few" : "many");
+    file_unmap(pBase, cbMap);
+    return (1);
+  }
+
+  for(nBuckets = 1, i1 = 0; i1 < k; i1++)
+  {
+    nBuckets *= 10;
+  }
+
+  pStart = (int64_t *)Fcalloc((Size_T)nBuckets + 1, sizeof(int64_t));
+  pNext = (int64_t *)Fcalloc((Size_T)nBuckets + 1, sizeof(int64_t));
+  pPos = (uint32_t *)Fcalloc((Size_T)(llHave - k + 1), sizeof(uint32_t));
+
+  if(!pStart || !pNext || !pPos)
+  {
+    memerr(MAX_SERIES + 4);
+  }
+
+  index_pass(pDigits, llHave, k, nBuckets, pStart, NULL, NULL); // the bucket sizes
+
+  for(i1 = 0; i1 < nBuckets; i1++)
+  {
+    pStart[i1 + 1] += pStart[i1];
+  }
+
+  memcpy(pNext, pStart, (nBuckets + 1) * sizeof(int64_t));
+  index_pass(pDigits, llHave, k, nBuckets, pStart, pNext, pPos);
+
+  memset(&ih, 0, sizeof(ih));
+  memcpy(ih.szMagic, INDEX_MAGIC, sizeof(ih.szMagic));
+  ih.llDigits = llHave;
+  ih.k = k;
+
+  snprintf(szIdx, sizeof(szIdx), "%s.idx", pName);
+
+  nRet = NULL == (pF = fopen(szIdx, "wb"));
+
+  if(!nRet)
+  {
+    nRet = fwrite(&ih, sizeof(ih), 1, pF) != 1 ||
+           fwrite(pStart, sizeof(int64_t), (Size_T)nBuckets + 1, pF) != (Size_T)nBuckets + 1 ||
+           fwrite(pPos, sizeof(uint32_t), (Size_T)(llHave - k + 1), pF) != (Size_T)(llHave - k + 1);
+    nRet |= fclose(pF) != 0;
+  }
+
+  if(nRet)
+  {
+    fprintf(stderr, "\nCan't write '%s'\n", szIdx);
+    remove(szIdx);
+  }
+  else
+  {
+    printf("'%s':  %d digit k-mers of %lld digits, %.3f s\n", szIdx, k, (long long)llHave,
+           (double)(ns_clock() - ullT0) / 1e9);
+  }
+
+  Ffree(pPos);
+  Ffree(pNext);
+  Ffree(pStart);
+  file_unmap(pBase, cbMap);
+
+  return nRet;
+}
+
+// searches with 'pName.idx'.  Returns zero if there's no index that can be used
+
+int search_index(const char *pName, const uint8_t *pDigits, int64_t llHave, const uint8_t *pPat, int32_t nPat,
+                 SEARCH_HITS *pH)
+{
+INDEX_HEADER ih;
+const int64_t *pStart;
+const uint32_t *pPos;
+void *pBase;
+Size_T cbMap;
+char szIdx[FILENAME_MAX];
+int64_t llPos, ll1, ll2;
+int32_t nBuckets, v, vBest, nBest, i1, i2;
+
+  snprintf(szIdx, sizeof(szIdx), "%s.idx", pName);
+
+  if(NULL == (pBase = file_map(szIdx, &cbMap)))
+  {
+    return 0;
+  }
+
+  memcpy(&ih, pBase, cbMap < sizeof(ih) ? 0 : sizeof(ih));
+
+  for(nBuckets = 1, i1 = 0; i1 < ih.k && i1 < INDEX_MAX_K; i1++)
+  {
+    nBuckets *= 10;
+  }
+
+  if(cbMap < sizeof(ih) || memcmp(ih.szMagic, INDEX_MAGIC, sizeof(ih.szMagic)) || ih.k < 1 || ih.k > INDEX_MAX_K ||
+     cbMap != sizeof(ih) + (nBuckets + 1) * sizeof(int64_t) + (ih.llDigits - ih.k + 1) * sizeof(uint32_t))
+  {
+    fprintf(stderr, "NOTE:  '%s' isn't an index, scanning\n", szIdx);
+    file_unmap(pBase, cbMap);
+    return 0;
+  }
+
+  if(ih.llDigits != llHave)
+  {
+    fprintf(stderr, "NOTE:  '%s' is for %lld digits, not %lld, scanning ('--index' builds it again)\n",
+            szIdx, (long long)ih.llDigits, (long long)llHave);
+    file_unmap(pBase, cbMap);
+    return 0;
+  }
+
+  pStart = (const int64_t *)((const char *)pBase + sizeof(ih));
+  pPos = (const uint32_t *)(pStart + nBuckets + 1);
+
+  if(nPat >= ih.k) // the rarest k-mer in the pattern, and everywhere it is
+  {
+    for(vBest = nBest = i1 = 0; i1 + ih.k <= nPat; i1++)
+    {
+      for(v = i2 = 0; i2 < ih.k; i2++)
+      {
+        v = v * 10 + pPat[i1 + i2];
+      }
+
+      if(!i1 || pStart[v + 1] - pStart[v] < pStart[vBest + 1] - pStart[vBest])
+      {
+        vBest = v;
+        nBest = i1;
+      }
+    }
+
+    for(ll1 = pStart[vBest]; ll1 < pStart[vBest + 1]; ll1++)
+    {
+      llPos = (int64_t)pPos[ll1] - nBest;
+
+      if(llPos < 1 || llPos + nPat - 1 > llHave)
+      {
+        continue;
+      }
+
+      for(i2 = 0; i2 < nPat && store_digit(pDigits, llPos + i2) == pPat[i2]; i2++)
+        ;
+
+      if(i2 == nPat)
+      {
+        search_hit(pH, llPos);
+      }
+    }
+  }
+  else // every k-mer that starts with it is one run of buckets
+  {
+    for(v = i2 = 0, i1 = 1; i2 < ih.k; i2++)
+    {
+      v = v * 10 + (i2 < nPat ? pPat[i2] : 0);
+      i1 *= i2 < nPat ? 1 : 10; // the buckets in the run
+    }
+
+    for(ll1 = pStart[v], ll2 = pStart[v + i1]; ll1 < ll2; ll1++)
+    {
+      search_hit(pH, (int64_t)pPos[ll1]);
+    }
+
+    // and the last few places, too close to the end for a k-mer
+    for(llPos = llHave - ih.k + 2; llPos + nPat - 1 <= llHave; llPos++)
+    {
+      for(i2 = 0; i2 < nPat && store_digit(pDigits, llPos + i2) == pPat[i2]; i2++)
+        ;
+
+      if(i2 == nPat)
+      {
+        search_hit(pH, llPos);
+      }
+    }
+  }
+
+  file_unmap(pBase, cbMap);
+  return 1;
+}
+
+// 'pi --search file digits [count]' - where 'digits' are in the store 'file', the first
+// 'count' places (SEARCH_SHOW) and how many there are.  Returns the exit code
+
+int search_run(const char *pName, const char *pDigitString, int nShow)
+{
+STORE_HEADER h;
+SEARCH_HITS *pH;
+const uint8_t *pDigits;
+uint8_t aPat[SEARCH_MAX_PATTERN];
+int64_t llHave;
+void *pBase;
+Size_T cbMap;
+uint64_t ullT0;
+int32_t nPat;
+int bIndex, i1;
+
+  for(nPat = 0; pDigitString[nPat] >= '0' && pDigitString[nPat] <= '9' && nPat < SEARCH_MAX_PATTERN; nPat++)
+  {
+    aPat[nPat] = (uint8_t)(pDigitString[nPat] - '0');
+  }
+
+  if(!nPat || pDigitString[nPat])
+  {
+    fprintf(stderr, "\nsearch for 1 to %d decimal digits\n", SEARCH_MAX_PATTERN);
+    return (1);
+  }
+
+  if(NULL == (pDigits = store_map(pName, &h, &llHave, &pBase, &cbMap)))
+  {
+    fprintf(stderr, "\nCan't read '%s'\n", pName);
+    return (1);
+  }
+
+  if(NULL == (pH = (SEARCH_HITS *)Fcalloc((Size_T)1, sizeof(SEARCH_HITS))))
+  {
+    memerr(MAX_SERIES + 4);
+  }
+
+  pH->nShow = nShow < 0 ? 0 : nShow > SEARCH_MAX_SHOW ? SEARCH_MAX_SHOW : nShow;
+
+  ullT0 = ns_clock();
+
+  if(!(bIndex = search_index(pName, pDigits, llHave, aPat, nPat, pH)))
+  {
+    search_store(pDigits, llHave, aPat, nPat, pH);
+  }
+
+  printf("'%s' is in the %lld digits of '%s' %lld time%s (%s, %.3f ms)\n", pDigitString,
+         (long long)llHave, pName, (long long)pH->llCount, pH->llCount == 1 ? "" : "s",
+         bIndex ? "index" : "scan", (double)(ns_clock() - ullT0) / 1e6);
+
+  for(i1 = 0; i1 < pH->nKept; i1++)
+  {
+    printf("  %lld\n", (long long)pH->allPos[i1]);
+  }
+
+  Ffree(pH);
+  file_unmap(pBase, cbMap);
+
+  return (0);
+}
+
+#ifndef PI_LIBRARY
+int main(int argc, char *argv[])
+{
+#ifdef _WIN32
+unsigned long dwStartTick = GetTickCount();
+#else   // _WIN32
+unsigned long dwStartTick = MyGetTickCount();
+#endif // _WIN32
+
+int i = 0;
+char *endp;
+const char *p1, *p2, *pProgName = argv[0];
+const char *pFormula = "machin";
+int bRecip = 0;
+int bChud = 0;
+const char *pHexList = NULL;
+const char *pOutName = NULL;
+const char *pResume = NULL;
+const char *pTune = NULL;
+const char *pStore = NULL;
+const char *pProfile = PROFILE_NAME;
+char szFormula[MAX_SERIES * 48];
+PI_ENGINE *pE;
+
+  if(argc > 2 && !strcmp(argv[1], "--verify")) // spot-checks a finished run, no digits computed
+  {
+    return verify_run(argv[2], argc > 3 ? atoi(argv[3]) : VERIFY_SAMPLES);
+  }
+
+  if(argc > 3 && !strcmp(argv[1], "--query")) // digits out of a store, none computed
+  {
+    return store_query(argv[2], strtoll(argv[3], NULL, 10),
+                       argc > 4 ? strtoll(argv[4], NULL, 10) : STORE_QUERY_DIGITS);
+  }
+
+  if(argc > 3 && !strcmp(argv[1], "--search")) // finds digits in a store
+  {
+    return search_run(argv[2], argv[3], argc > 4 ? atoi(argv[4]) : SEARCH_SHOW);
+  }
+
+  if(argc > 2 && !strcmp(argv[1], "--index")) // so '--search' doesn't have to scan
+  {
+    return index_build(argv[2], argc > 3 ? atoi(argv[3]) : INDEX_K);
+  }
+
+  if(argc > 2 && !strcmp(argv[1], "--monitor")) // watches another run's '-I' segment
+  {
+    return telem_monitor(argv[2], argc > 3 ? atoi(argv[3]) : 1);
+  }
+
+  // the run, set up the way the library does it ('run_reset'), then the options change it
+  if(NULL == (pE = pi_engine_create(1, NULL)))
+  {
+    memerr(MAX_SERIES + 5);
+  }
+
+  pRunEngine = pE;
+
+  while(argc > 1 && argv[1][0] == '-')
+  {
+    p1 = argv[1] + 1;
+    p2 = NULL;
+
+    if(!strcmp(p1, "-bench")) // '--bench [csv|json] [max_digits]', and nothing else
+    {
+      return bench_run(argc > 2 ? argv[2] : "csv", argc > 3 ? atol(argv[3]) : 1000000L);
+    }
+
+    if(!strcmp(p1, "-tune")) // '--tune [file]'
+    {
+      pTune = PROFILE_NAME;
+
+      if(argc > 2 && argv[2][0] != '-')
+      {
+        argc--;
+        argv++;
+
+        pTune = argv[1];
+      }
+
+      argc--;
+      argv++;
+      continue;
+    }
+
+    if(!strcmp(p1, "-store") && argc > 2) // '--store file'
+    {
+      pStore = argv[2];
+
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if(!strcmp(p1, "-resume")) // '--resume [file]'
+    {
+      pResume = CKPT_NAME;
+
+      if(argc > 2 && argv[2][0] != '-')
+      {
+        argc--;
+        argv++;
+
+        pResume = argv[1];
+      }
+
+      argc--;
+      argv++;
+      continue;
+    }
+
+    if(*p1 && strchr("ktbdfxomsSPiI", *p1)) // options with a value, '-k4' or '-k 4'
+    {
+      if(p1[1])
+      {
+        p2 = p1 + 1;
+      }
+      else if(argc > 2)
+      {
+        argc--;
+        argv++;
+
+        p2 = argv[1];
+      }
+      else // it was the last argument
+      {
+        fprintf(stderr, "\n'-%c' needs a value\n", *p1);
+        return (1);
+      }
+    }
+
+    if(*p1 == 'k') // digits per sweep
+    {
+      pE->nChunk = atoi(p2);
+
+      if(pE->nChunk < 1 || pE->nChunk > MAX_CHUNK)
+      {
+        fprintf(stderr, "\n'-k' must be between 1 and %d\n", MAX_CHUNK);
+        return (1);
+      }
+    }
+    else if(*p1 == 'f') // formula
+    {
+      pFormula = p2;
+    }
+    else if(*p1 == 'x') // BBP hex digits
+    {
+      pHexList = p2;
+    }
+    else if(*p1 == 'o') // packed digits to a file
+    {
+      pOutName = p2;
+    }
+    else if(*p1 == 'm') // where the terms live
+    {
+      set_term_mem(p2);
+    }
+    else if(*p1 == 's') // checkpoint interval
+    {
+      pE->nCkptSecs = atoi(p2);
+
+      if(pE->nCkptSecs < 1)
+      {
+        fprintf(stderr, "\n'-s' must be at least 1 second\n");
+        return (1);
+      }
+    }
+    else if(*p1 == 'S') // checkpoint file
+    {
+      pCkptName = p2;
+    }
+    else if(*p1 == 'P') // threading profile
+    {
+      pProfile = p2;
+    }
+    else if(*p1 == 'i') // progress interval
+    {
+      nTelemSecs = atoi(p2);
+
+      if(nTelemSecs < 1)
+      {
+        fprintf(stderr, "\n'-i' must be at least 1 second\n");
+        return (1);
+      }
+    }
+    else if(*p1 == 'I') // telemetry segment
+    {
+      pTelemName = p2;
+    }
+    else if(*p1 == 'c' && !p1[1]) // Chudnovsky instead of the spigot
+    {
+      bChud = 1;
+    }
+    else if(*p1 == 'r' && !p1[1]) // reciprocal tables
+    {
+#ifdef HAS_RECIP
+      bRecip = 1;
+#else  // HAS_RECIP
+      fprintf(stderr, "NOTE:  '-r' needs 128-bit integer support, ignored\n");
+#endif // HAS_RECIP
+    }
+    else if(*p1 == 't') // wavefront engine threads
+    {
+      pE->nTileThreads = atoi(p2);
+
+      if(pE->nTileThreads < 1)
+      {
+        fprintf(stderr, "\n'-t' must be at least 1\n");
+        return (1);
+      }
+#ifndef USE_THREAD
+      pE->nTileThreads = 1; // cache blocking only
+#endif // USE_THREAD
+    }
+    else if(*p1 == 'b') // wavefront block size
+    {
+      pE->nTileBlock = atoi(p2);
+
+      if(pE->nTileBlock < 16)
+      {
+        fprintf(stderr, "\n'-b' must be at least 16\n");
+        return (1);
+      }
+    }
+    else if(*p1 == 'd') // wavefront batch depth
+    {
+      pE->nTileDepth = atoi(p2);
+
+      if(pE->nTileDepth < 1 || pE->nTileDepth > MAX_TILE_DEPTH)
+      {
+        fprintf(stderr, "\n'-d' must be between 1 and %d\n", MAX_TILE_DEPTH);
+        return (1);
       }
     }
+    else
+    {
+      argc = 0; // unknown option, show usage
+      break;
+    }
+
+    argc--;
+    argv++;
+  }
+
+  if(pHexList && argc > 0) // no digit count needed
+  {
+    return hex_run(pHexList);
+  }
+
+  if(pTune) // measures, saves the profile, and that's all
+  {
+    for(pE->lChunk = 10, i = 1; i < pE->nChunk; i++)
+    {
+      pE->lChunk *= 10;
+    }
+
+    return set_formula(pE, pFormula) ? tune_run(pE, pTune, bRecip) : 1;
+  }
+
+  if(pResume) // everything comes from the checkpoint
+  {
+    if(!ckpt_load(pE, pResume, szFormula, sizeof(szFormula), &bRecip, &pOutName))
+    {
+      return (1);
+    }
+
+    pFormula = szFormula;
+    bChud = 0;
+  }
+  else if(argc < 2)
+  {
+    fprintf(stderr, "\nUsage: %s [-k digits_per_sweep] [-r] [-f formula] [-t threads [-b block] [-d depth]] [-c] [-o file] [-m heap|thp|huge|dir] [-s seconds [-S file]] [-P profile] [-i seconds] [-I name] <number_of_digits>\n"
+                    "       %s [-c] [-k digits_per_sweep] [-r] [-f formula] [-t threads] --store file <number_of_digits>\n"
+                    "       %s --query file first_digit [count]\n"
+                    "       %s --search file digits [count]\n"
+                    "       %s --index file [k]\n"
+                    "       %s --resume [file]\n"
+                    "       %s --monitor name [seconds]\n"
+                    "       %s --bench [csv|json] [max_digits]\n"
+                    "       %s [-f formula] [-k digits_per_sweep] [-r] --tune [profile]\n"
+                    "       %s -x position[,position...]\n"
+                    "       %s --verify file [positions]\n\n", pProgName, pProgName, pProgName, pProgName, pProgName, pProgName, pProgName, pProgName, pProgName,
+                    pProgName, pProgName);
+    return (1);
+  }
+
+  for(pE->lChunk = 10, i = 1; i < pE->nChunk; i++)
+  {
+    pE->lChunk *= 10;
+  }
+
+  if(!pResume)
+  {
+    pE->n = strtol(argv[1], &endp, 10);
+  }
+
+  if(!set_formula(pE, pFormula))
+  {
+    return (1);
+  }
+
+  if(!profile_load(pProfile) && strcmp(pProfile, PROFILE_NAME)) // the default one is optional
+  {
+    fprintf(stderr, "NOTE:  can't use profile '%s'\n", pProfile);
+  }
+
+  if(pStore) // the digits go in the store, not on stdout
+  {
+    PI_OPTIONS opts;
+
+    memset(&opts, 0, sizeof(opts));
+    opts.nEngine = bChud ? PI_CHUDNOVSKY : PI_SPIGOT;
+    opts.nDigitsPerSweep = pE->nChunk;
+    opts.bRecip = bRecip;
+    opts.nTileThreads = pE->nTileThreads;
+    opts.pFormula = pFormula;
+
+    return store_extend(pStore, pE->n, &opts);
+  }
+
+  if(!out_open(pE, pOutName, pResume ? ckResume.llOutPos : -1, pResume ? ckResume.nOutHalf : -1))
+  {
+    return (1);
+  }
+
+  pCkptOut = pOutName;
+
+  if(bChud && pE->nCkptSecs)
+  {
+    fprintf(stderr, "NOTE:  the Chudnovsky engine doesn't stop between sweeps, no checkpoints\n");
+    pE->nCkptSecs = 0;
+  }
+
+  if(!telem_start(pE, bChud ? PI_CHUDNOVSKY : PI_SPIGOT))
+  {
+    return (1);
+  }
+
+  if(bChud)
+  {
+    printf("\nApproximation of PI to %ld digits\n", (long)pE->n);
+    chud_run(pE);
+  }
+  else
+  {
+    spigot_run(pE, bRecip);
+  }
 
-    nd = 0;
-    shift1((int32_t FAR *) & nd, mf + 1, 5L);
-    shift1((int32_t FAR *) & nd, ms + 1, 239L);
-    xprint(nd);
+  out_close(pE);
+  telem_stop();
+
+  if(pOutName)
+  {
+    printf("\n%ld digits after the '3.' written to '%s', packed 2 to a byte\n", (long)pE->cnt, pOutName);
   }
+
 #ifdef CHECK_LOC
-  printf("\n\nCalculations Completed!  max_loc=%d\n", max_loc);
+  printf("\n\nCalculations Completed!  max_loc=%d\n", pE->max_loc);
 #else  // CHECK_LOC
   printf("\n\nCalculations Completed!\n");
 #endif  // CHECK_LOC
@@ -601,8 +6944,8 @@ old_way:
          (int)(dwStartTick % 1000L),
          dwStartTick);
 
-  Ffree(ms);
-  Ffree(mf);
+  free_series(pE);
+  pi_engine_destroy(pE);
   return (0);
 }
-
+#endif // PI_LIBRARY
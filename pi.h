@@ -0,0 +1,83 @@
+/*
+**  PI.H - the library interface to PI.C
+**
+**  Build pi.c with 'PI_LIBRARY' defined and it leaves out 'main' and exports these instead:
+**
+**    gcc -O2 -c -DPI_LIBRARY pi.c -Wall
+**    gcc -O2 -o myprog myprog.c pi.o -lpthread -lm
+**
+**  An engine is one run:  the digit count and the options.  'pi_engine_run' computes it
+**  and hands the digits after the '3.' to the callback in blocks, in order, on the thread
+**  that called 'pi_engine_run'.  Each engine keeps its own run state, so engines on
+**  different threads run at the same time, each with the cores it's allowed to.  One
+**  engine must not be run from two threads at once.  The CLI-only parts ('-m', the
+**  checkpoints, the telemetry segment and '--bench') aren't reachable from here.
+*/
+
+#ifndef _PI_H_
+#define _PI_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define PI_SPIGOT 0       /* the Machin-like spigot, O(n^2) */
+#define PI_CHUDNOVSKY 1   /* binary splitting, O(n log^2 n), see '-c' */
+
+typedef struct _PI_OPTIONS_
+{
+  int nEngine;           // PI_SPIGOT or PI_CHUDNOVSKY
+  int nDigitsPerSweep;   // spigot:  '-k', 1 through 9, 0 for 1
+  int bRecip;            // spigot:  '-r', reciprocal tables
+  int nTileThreads;      // spigot:  '-t', the wavefront engine, 0 for none
+  const char *pFormula;  // spigot:  '-f', NULL for Machin's
+} PI_OPTIONS;
+
+typedef struct _PI_ENGINE_ PI_ENGINE;
+
+// 'pDigits' is 'nDigits' ASCII digits, the first one is digit 'nFirst' after the point
+// (1 is the first).  'pUser' is what was passed to 'pi_engine_run'
+typedef void (*PI_DIGITS_CB)(void *pUser, const char *pDigits, int32_t nDigits, int32_t nFirst);
+
+// NULL if the options are bad ('pOpts' may be NULL for the defaults)
+PI_ENGINE *pi_engine_create(int32_t nDigits, const PI_OPTIONS *pOpts);
+
+// returns 0 when all the digits have gone through 'pfnDigits', 1 if the options didn't
+// work out, and 2 if it ran out of memory (the digits so far went through, and the engine
+// can be run again)
+int pi_engine_run(PI_ENGINE *pEngine, PI_DIGITS_CB pfnDigits, void *pUser);
+
+void pi_engine_destroy(PI_ENGINE *pEngine);
+
+// TELEMETRY - 'pi -i seconds -I name' keeps one of these up to date in the POSIX shared
+// memory segment 'name' (as in 'shm_open', '/pi' for instance).  Only the reporting thread
+// writes it.  A monitor maps it read-only and copies it out, and the copy is good if 'nSeq'
+// was even and the same before and after.  'pi --monitor name' is one
+#define PI_STATS_MAGIC 0x53544950 /* 'PITS' */
+#define PI_STATS_THREADS 64
+
+typedef struct _PI_STATS_
+{
+  uint32_t nMagic;        // PI_STATS_MAGIC once it's set up
+  volatile uint32_t nSeq; // odd while the reporter is changing it
+  int32_t nPid;           // the process computing
+  int32_t nEngine;        // PI_SPIGOT or PI_CHUDNOVSKY
+  int32_t nDigits;        // the digits asked for
+  int32_t nDone;          // and the digits out so far
+  int32_t nSweepLen;      // spigot:  terms in the current series 0 sweep
+  int32_t nThreads;       // the entries of 'aullBusyNs' in use
+  int32_t bFinished;      // the run is over, nothing else will change
+  int32_t nPad;
+  double dElapsed;        // seconds since the run started
+  double dDigitsPerSec;   // over the last interval
+  double dEta;            // seconds left, -1 if there's no telling
+  uint64_t aullBusyNs[PI_STATS_THREADS]; // time each thread spent computing
+} PI_STATS;
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // _PI_H_